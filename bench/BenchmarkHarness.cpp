@@ -0,0 +1,314 @@
+#include "BenchmarkHarness.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+
+namespace GA {
+namespace Bench {
+
+    // State implementation
+    State::State(const std::vector<int64_t>& arguments, int64_t iterations, const HardwareCounters* hardware)
+        : arguments(arguments), maxIterations(iterations), remaining(iterations), started(false),
+          paused(false), itemsProcessed(0), pausedTime(0), elapsedTime(0), hardware(hardware) {
+    }
+
+    bool State::keepRunning() {
+        if (!started) {
+            started = true;
+            if (hardware) {
+                hardwareStart = hardware->read();
+            }
+            startTime = std::chrono::steady_clock::now();
+        }
+        if (remaining > 0) {
+            --remaining;
+            return true;
+        }
+
+        auto endTime = std::chrono::steady_clock::now();
+        elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime) - pausedTime;
+        if (hardware) {
+            hardwareCounts = (hardware->read() - hardwareStart) - hardwarePaused;
+        }
+        return false;
+    }
+
+    int64_t State::range(size_t index) const {
+        return index < arguments.size() ? arguments[index] : 0;
+    }
+
+    void State::pauseTiming() {
+        if (!paused) {
+            paused = true;
+            pauseTime = std::chrono::steady_clock::now();
+            if (hardware) {
+                hardwarePause = hardware->read();
+            }
+        }
+    }
+
+    void State::resumeTiming() {
+        if (paused) {
+            paused = false;
+            if (hardware) {
+                hardwarePaused += hardware->read() - hardwarePause;
+            }
+            pausedTime += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - pauseTime);
+        }
+    }
+
+    void State::setItemsProcessed(int64_t items) {
+        itemsProcessed = items;
+    }
+
+    void State::setLabel(const std::string& text) {
+        label = text;
+    }
+
+    int64_t State::iterations() const {
+        return maxIterations;
+    }
+
+    int64_t State::getItemsProcessed() const {
+        return itemsProcessed;
+    }
+
+    const std::string& State::getLabel() const {
+        return label;
+    }
+
+    double State::elapsedSeconds() const {
+        return elapsedTime.count() * 1e-9;
+    }
+
+    const HardwareCounterValues& State::getHardwareCounts() const {
+        return hardwareCounts;
+    }
+
+    // Benchmark implementation
+    Benchmark::Benchmark(const std::string& name, BenchmarkFunction function)
+        : name(name), function(std::move(function)) {
+    }
+
+    Benchmark* Benchmark::Args(const std::vector<int64_t>& arguments) {
+        argumentSets.push_back(arguments);
+        return this;
+    }
+
+    Benchmark* Benchmark::ArgsProduct(const std::vector<std::vector<int64_t>>& lists) {
+        std::vector<std::vector<int64_t>> product = {{}};
+        for (const std::vector<int64_t>& list : lists) {
+            std::vector<std::vector<int64_t>> extended;
+            for (const std::vector<int64_t>& prefix : product) {
+                for (int64_t value : list) {
+                    std::vector<int64_t> combination = prefix;
+                    combination.push_back(value);
+                    extended.push_back(combination);
+                }
+            }
+            product = extended;
+        }
+        for (const std::vector<int64_t>& combination : product) {
+            argumentSets.push_back(combination);
+        }
+        return this;
+    }
+
+    const std::string& Benchmark::getName() const {
+        return name;
+    }
+
+    const BenchmarkFunction& Benchmark::getFunction() const {
+        return function;
+    }
+
+    const std::vector<std::vector<int64_t>>& Benchmark::getArgumentSets() const {
+        return argumentSets;
+    }
+
+    namespace {
+        std::vector<std::unique_ptr<Benchmark>>& registry() {
+            static std::vector<std::unique_ptr<Benchmark>> benchmarks;
+            return benchmarks;
+        }
+
+        std::string formatName(const std::string& name, const std::vector<int64_t>& arguments) {
+            std::ostringstream out;
+            out << name;
+            for (int64_t argument : arguments) {
+                out << "/" << argument;
+            }
+            return out.str();
+        }
+
+        std::string formatRate(double itemsPerSecond) {
+            if (itemsPerSecond <= 0.0) {
+                return "";
+            }
+            const char* units[] = {"", "k", "M", "G", "T"};
+            int unit = 0;
+            while (itemsPerSecond >= 1000.0 && unit < 4) {
+                itemsPerSecond /= 1000.0;
+                ++unit;
+            }
+            std::ostringstream out;
+            out << std::fixed << std::setprecision(2) << itemsPerSecond << units[unit] << " items/s";
+            return out.str();
+        }
+
+        // Grow the iteration count until the timed loop lasts at least minTime
+        BenchmarkResult measure(const Benchmark& benchmark, const std::vector<int64_t>& arguments, double minTime,
+                                const HardwareCounters* hardware) {
+            int64_t iterations = 1;
+            while (true) {
+                State state(arguments, iterations, hardware);
+                benchmark.getFunction()(state);
+                double seconds = state.elapsedSeconds();
+
+                if (seconds >= minTime || iterations >= 1000000000) {
+                    BenchmarkResult result;
+                    result.name = formatName(benchmark.getName(), arguments);
+                    result.iterations = iterations;
+                    result.nanosecondsPerOp = seconds * 1e9 / iterations;
+                    result.itemsPerSecond = (state.getItemsProcessed() > 0 && seconds > 0.0)
+                                                ? state.getItemsProcessed() / seconds : 0.0;
+                    result.label = state.getLabel();
+
+                    if (hardware) {
+                        const HardwareCounterValues& counts = state.getHardwareCounts();
+                        double units = static_cast<double>(
+                            state.getItemsProcessed() > 0 ? state.getItemsProcessed() : iterations);
+                        result.hasHardwareCounters = true;
+                        result.instructionsPerCycle = counts.instructionsPerCycle();
+                        result.cacheMissesPerItem = counts.get(HardwareEvent::CACHE_MISSES) / units;
+                        result.branchMissesPerItem = counts.get(HardwareEvent::BRANCH_MISSES) / units;
+                        result.dtlbMissesPerItem = counts.get(HardwareEvent::DTLB_MISSES) / units;
+                    }
+                    return result;
+                }
+
+                // Predict the needed count, growing by at least 2x and at most 10x
+                double multiplier = (seconds > 0.0) ? (minTime * 1.4 / seconds) : 10.0;
+                multiplier = std::max(2.0, std::min(10.0, multiplier));
+                iterations = static_cast<int64_t>(iterations * multiplier);
+            }
+        }
+
+        void writeJson(const std::string& path, const std::vector<BenchmarkResult>& results) {
+            FILE* file = std::fopen(path.c_str(), "w");
+            if (!file) {
+                std::cerr << "Cannot write benchmark results to " << path << std::endl;
+                return;
+            }
+            std::fprintf(file, "{\n  \"benchmarks\": [\n");
+            for (size_t i = 0; i < results.size(); ++i) {
+                const BenchmarkResult& result = results[i];
+                std::fprintf(file,
+                             "    {\"name\": \"%s\", \"iterations\": %lld, \"ns_per_op\": %.3f, "
+                             "\"items_per_second\": %.3f, \"label\": \"%s\"",
+                             result.name.c_str(), static_cast<long long>(result.iterations),
+                             result.nanosecondsPerOp, result.itemsPerSecond, result.label.c_str());
+                if (result.hasHardwareCounters) {
+                    std::fprintf(file,
+                                 ", \"ipc\": %.3f, \"cache_misses_per_item\": %.4f, "
+                                 "\"branch_misses_per_item\": %.4f, \"dtlb_misses_per_item\": %.4f",
+                                 result.instructionsPerCycle, result.cacheMissesPerItem,
+                                 result.branchMissesPerItem, result.dtlbMissesPerItem);
+                }
+                std::fprintf(file, "}%s\n", (i + 1 < results.size()) ? "," : "");
+            }
+            std::fprintf(file, "  ]\n}\n");
+            std::fclose(file);
+        }
+    }
+
+    Benchmark* registerBenchmark(const std::string& name, BenchmarkFunction function) {
+        registry().push_back(std::make_unique<Benchmark>(name, std::move(function)));
+        return registry().back().get();
+    }
+
+    int runBenchmarks(int argc, char** argv) {
+        std::string filter;
+        std::string jsonPath;
+        double minTime = 0.5;
+        bool perfCounters = false;
+
+        for (int i = 1; i < argc; ++i) {
+            std::string argument = argv[i];
+            if (argument.compare(0, 9, "--filter=") == 0) {
+                filter = argument.substr(9);
+            } else if (argument.compare(0, 11, "--min_time=") == 0) {
+                minTime = std::atof(argument.substr(11).c_str());
+            } else if (argument.compare(0, 7, "--json=") == 0) {
+                jsonPath = argument.substr(7);
+            } else if (argument == "--perf_counters") {
+                perfCounters = true;
+            } else {
+                std::cerr << "Usage: " << argv[0]
+                          << " [--filter=substring] [--min_time=seconds] [--json=path] [--perf_counters]" << std::endl;
+                return 1;
+            }
+        }
+
+        // Hardware counters are optional; without them only wall-clock numbers are reported
+        std::unique_ptr<HardwareCounters> hardware;
+        if (perfCounters) {
+            hardware = std::make_unique<HardwareCounters>();
+            if (!hardware->isAvailable()) {
+                std::cerr << "Hardware counters unavailable (" << hardware->getUnavailableReason()
+                          << "), reporting wall-clock only" << std::endl;
+                hardware.reset();
+            }
+        }
+
+        std::cout << std::left << std::setw(56) << "Benchmark" << std::right << std::setw(16) << "Time"
+                  << std::setw(14) << "Iterations" << "  Throughput" << std::endl;
+        std::cout << std::string(110, '-') << std::endl;
+
+        std::vector<BenchmarkResult> results;
+        for (const std::unique_ptr<Benchmark>& benchmark : registry()) {
+            std::vector<std::vector<int64_t>> argumentSets = benchmark->getArgumentSets();
+            if (argumentSets.empty()) {
+                argumentSets.push_back({});
+            }
+
+            for (const std::vector<int64_t>& arguments : argumentSets) {
+                std::string name = formatName(benchmark->getName(), arguments);
+                if (!filter.empty() && name.find(filter) == std::string::npos) {
+                    continue;
+                }
+
+                BenchmarkResult result = measure(*benchmark, arguments, minTime, hardware.get());
+                results.push_back(result);
+
+                std::ostringstream time;
+                time << std::fixed << std::setprecision(1) << result.nanosecondsPerOp << " ns";
+                std::cout << std::left << std::setw(56) << result.name << std::right << std::setw(16) << time.str()
+                          << std::setw(14) << result.iterations << "  " << formatRate(result.itemsPerSecond);
+                if (result.hasHardwareCounters) {
+                    std::cout << std::fixed << std::setprecision(2) << "  IPC " << result.instructionsPerCycle
+                              << std::setprecision(3) << ", cache-miss/item " << result.cacheMissesPerItem
+                              << ", branch-miss/item " << result.branchMissesPerItem
+                              << ", dTLB-miss/item " << result.dtlbMissesPerItem;
+                    std::cout.unsetf(std::ios::floatfield);
+                }
+                if (!result.label.empty()) {
+                    std::cout << " " << result.label;
+                }
+                std::cout << std::endl;
+            }
+        }
+
+        if (!jsonPath.empty()) {
+            writeJson(jsonPath, results);
+        }
+        return 0;
+    }
+}
+}
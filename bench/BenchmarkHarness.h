@@ -0,0 +1,181 @@
+#ifndef BENCHMARK_HARNESS_H
+#define BENCHMARK_HARNESS_H
+
+#include "HardwareCounters.h"
+#include <cstdint>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @file BenchmarkHarness.h
+ * @brief Minimal Google-Benchmark-style microbenchmark harness
+ *
+ * Benchmarks are registered with GA_BENCHMARK(function) and parameterized with
+ * ->Args({...}) or ->ArgsProduct({{...}, {...}}). Each benchmark body loops on
+ * state.keepRunning(); the harness grows the iteration count until the run
+ * lasts at least --min_time seconds and reports ns/op and items/s. With
+ * --perf_counters the timed loop is also measured with hardware counters.
+ */
+
+namespace GA {
+namespace Bench {
+    /**
+     * @brief Prevents the compiler from optimizing away a computed value
+     * @param value Value that must be considered used
+     */
+    template <typename T>
+    inline void doNotOptimize(const T& value) {
+        #if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+        #else
+        const volatile T* sink = &value;
+        (void)sink;
+        #endif
+    }
+
+    /**
+     * @class State
+     * @brief Per-run state handed to a benchmark body
+     */
+    class State {
+    private:
+        std::vector<int64_t> arguments;            // Parameters of this run
+        int64_t maxIterations;                     // Iterations requested by the harness
+        int64_t remaining;                         // Iterations left in this run
+        bool started;                              // Whether the timed loop has started
+        bool paused;                               // Whether timing is paused
+        int64_t itemsProcessed;                    // Items reported by the benchmark
+        std::string label;                         // Optional label appended to the report
+        std::chrono::steady_clock::time_point startTime;
+        std::chrono::steady_clock::time_point pauseTime;
+        std::chrono::nanoseconds pausedTime;       // Time spent in paused sections
+        std::chrono::nanoseconds elapsedTime;      // Timed duration of the loop
+        const HardwareCounters* hardware;          // Counters to sample (nullptr = off)
+        HardwareCounterValues hardwareStart;       // Reading when the loop started
+        HardwareCounterValues hardwarePause;       // Reading when timing was paused
+        HardwareCounterValues hardwarePaused;      // Counts accumulated while paused
+        HardwareCounterValues hardwareCounts;      // Counts of the timed loop
+
+    public:
+        State(const std::vector<int64_t>& arguments, int64_t iterations, const HardwareCounters* hardware = nullptr);
+
+        /**
+         * @brief Advances the timed loop
+         * @return True while iterations remain
+         */
+        bool keepRunning();
+
+        /**
+         * @brief Gets a benchmark parameter
+         * @param index Parameter index
+         * @return Parameter value
+         */
+        int64_t range(size_t index) const;
+
+        /**
+         * @brief Stops the clock (for per-iteration setup that must not be measured)
+         */
+        void pauseTiming();
+
+        /**
+         * @brief Restarts the clock after pauseTiming()
+         */
+        void resumeTiming();
+
+        /**
+         * @brief Reports how many items were processed in total
+         * @param items Item count across all iterations
+         */
+        void setItemsProcessed(int64_t items);
+
+        /**
+         * @brief Attaches a free-form label to the report line
+         * @param text Label text
+         */
+        void setLabel(const std::string& text);
+
+        int64_t iterations() const;
+        int64_t getItemsProcessed() const;
+        const std::string& getLabel() const;
+        double elapsedSeconds() const;
+        const HardwareCounterValues& getHardwareCounts() const;
+    };
+
+    using BenchmarkFunction = std::function<void(State&)>;
+
+    /**
+     * @class Benchmark
+     * @brief A registered benchmark with its parameter sets
+     */
+    class Benchmark {
+    private:
+        std::string name;
+        BenchmarkFunction function;
+        std::vector<std::vector<int64_t>> argumentSets;
+
+    public:
+        Benchmark(const std::string& name, BenchmarkFunction function);
+
+        /**
+         * @brief Adds one parameter set
+         * @param arguments Parameter values
+         * @return This benchmark (for chaining)
+         */
+        Benchmark* Args(const std::vector<int64_t>& arguments);
+
+        /**
+         * @brief Adds the cartesian product of parameter lists
+         * @param lists One list of values per parameter
+         * @return This benchmark (for chaining)
+         */
+        Benchmark* ArgsProduct(const std::vector<std::vector<int64_t>>& lists);
+
+        const std::string& getName() const;
+        const BenchmarkFunction& getFunction() const;
+        const std::vector<std::vector<int64_t>>& getArgumentSets() const;
+    };
+
+    /**
+     * @struct BenchmarkResult
+     * @brief Measurement of one benchmark/parameter combination
+     */
+    struct BenchmarkResult {
+        std::string name;                          // Benchmark name including parameters
+        int64_t iterations;                        // Iterations of the final run
+        double nanosecondsPerOp;                   // Timed nanoseconds per iteration
+        double itemsPerSecond;                     // Items per second (0 if not reported)
+        std::string label;                         // Label set by the benchmark
+        bool hasHardwareCounters = false;          // Whether the fields below were measured
+        double instructionsPerCycle = 0.0;         // Instructions per cycle of the timed loop
+        double cacheMissesPerItem = 0.0;           // Per item (per iteration if no items were reported)
+        double branchMissesPerItem = 0.0;
+        double dtlbMissesPerItem = 0.0;
+    };
+
+    /**
+     * @brief Registers a benchmark (used by GA_BENCHMARK)
+     * @param name Benchmark name
+     * @param function Benchmark body
+     * @return The registered benchmark
+     */
+    Benchmark* registerBenchmark(const std::string& name, BenchmarkFunction function);
+
+    /**
+     * @brief Runs every registered benchmark matching the command-line filter
+     * @param argc Argument count (supports --filter=, --min_time=, --json=, --perf_counters)
+     * @param argv Argument values
+     * @return Exit code
+     */
+    int runBenchmarks(int argc, char** argv);
+}
+}
+
+#define GA_BENCHMARK_CONCAT_INNER(a, b) a##b
+#define GA_BENCHMARK_CONCAT(a, b) GA_BENCHMARK_CONCAT_INNER(a, b)
+#define GA_BENCHMARK(function) \
+    static ::GA::Bench::Benchmark* GA_BENCHMARK_CONCAT(benchmarkRegistration_, __LINE__) = \
+        ::GA::Bench::registerBenchmark(#function, function)
+
+#endif // BENCHMARK_HARNESS_H
@@ -0,0 +1,262 @@
+#include "BenchmarkHarness.h"
+#include "GeneticAlgorithm.h"
+#include "FitnessFunction.h"
+#include "Individual.h"
+#include <memory>
+#include <random>
+#include <vector>
+
+/**
+ * @file MicroBenchmarks.cpp
+ * @brief Microbenchmarks for the genetic operators and built-in fitness functions
+ *
+ * Parameters: chromosome length for per-individual operators, and
+ * (population size, chromosome length) for population-wide operations.
+ * All inputs are generated from fixed seeds so runs are comparable.
+ */
+
+using namespace GA;
+using GA::Bench::State;
+using GA::Bench::doNotOptimize;
+
+namespace {
+    const unsigned int BENCHMARK_SEED = 12345;
+
+    std::vector<Individual> makeIndividuals(int count, int chromosomeLength, std::mt19937& rng) {
+        std::vector<Individual> individuals;
+        individuals.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            Individual individual(chromosomeLength);
+            individual.randomize(chromosomeLength, rng);
+            individuals.push_back(individual);
+        }
+        return individuals;
+    }
+
+    GAConfig makeConfig(int populationSize, int chromosomeLength, bool maximize) {
+        GAConfig config;
+        config.populationSize = populationSize;
+        config.chromosomeLength = chromosomeLength;
+        config.isMaximization = maximize;
+        config.randomSeed = BENCHMARK_SEED;
+        return config;
+    }
+
+    // Engine with an initialized and evaluated population
+    std::unique_ptr<GeneticAlgorithm> makeEvaluatedEngine(int populationSize, int chromosomeLength, bool maximize) {
+        std::unique_ptr<GeneticAlgorithm> ga = std::make_unique<GeneticAlgorithm>(
+            makeConfig(populationSize, chromosomeLength, maximize),
+            std::make_unique<RastriginFunction>(10.0, maximize));
+        ga->initializePopulation();
+        ga->evaluatePopulation();
+        return ga;
+    }
+
+    // Individual operators
+
+    void BM_SinglePointCrossover(State& state) {
+        int length = static_cast<int>(state.range(0));
+        std::mt19937 rng(BENCHMARK_SEED);
+        std::vector<Individual> parents = makeIndividuals(2, length, rng);
+        std::uniform_int_distribution<int> pointDist(1, length - 1);
+
+        while (state.keepRunning()) {
+            auto offspring = parents[0].singlePointCrossover(parents[1], pointDist(rng));
+            doNotOptimize(offspring);
+        }
+        state.setItemsProcessed(state.iterations() * 2);
+    }
+    GA_BENCHMARK(BM_SinglePointCrossover)->Args({16})->Args({32})->Args({64})->Args({256})->Args({1024});
+
+    void BM_TwoPointCrossover(State& state) {
+        int length = static_cast<int>(state.range(0));
+        std::mt19937 rng(BENCHMARK_SEED);
+        std::vector<Individual> parents = makeIndividuals(2, length, rng);
+        std::uniform_int_distribution<int> pointDist(1, length - 1);
+
+        while (state.keepRunning()) {
+            int point1 = pointDist(rng);
+            int point2 = pointDist(rng);
+            if (point1 > point2) {
+                std::swap(point1, point2);
+            }
+            auto offspring = parents[0].twoPointCrossover(parents[1], point1, point2);
+            doNotOptimize(offspring);
+        }
+        state.setItemsProcessed(state.iterations() * 2);
+    }
+    GA_BENCHMARK(BM_TwoPointCrossover)->Args({16})->Args({32})->Args({64})->Args({256})->Args({1024});
+
+    void BM_UniformCrossover(State& state) {
+        int length = static_cast<int>(state.range(0));
+        std::mt19937 rng(BENCHMARK_SEED);
+        std::vector<Individual> parents = makeIndividuals(3, length, rng);
+        const Chromosome& mask = parents[2].getChromosome();
+
+        while (state.keepRunning()) {
+            auto offspring = parents[0].uniformCrossover(parents[1], mask);
+            doNotOptimize(offspring);
+        }
+        state.setItemsProcessed(state.iterations() * 2);
+    }
+    GA_BENCHMARK(BM_UniformCrossover)->Args({16})->Args({32})->Args({64})->Args({256})->Args({1024});
+
+    void BM_Mutate(State& state) {
+        int length = static_cast<int>(state.range(0));
+        std::mt19937 rng(BENCHMARK_SEED);
+        std::vector<Individual> individuals = makeIndividuals(1, length, rng);
+
+        while (state.keepRunning()) {
+            individuals[0].mutate(0.01, rng);
+            doNotOptimize(individuals[0]);
+        }
+        state.setItemsProcessed(state.iterations());
+    }
+    GA_BENCHMARK(BM_Mutate)->Args({16})->Args({32})->Args({64})->Args({256})->Args({1024});
+
+    void BM_DecodeToValue(State& state) {
+        int length = static_cast<int>(state.range(0));
+        std::mt19937 rng(BENCHMARK_SEED);
+        std::vector<Individual> individuals = makeIndividuals(64, length, rng);
+
+        size_t index = 0;
+        while (state.keepRunning()) {
+            double value = individuals[index].decodeToValue(-10.0, 10.0);
+            doNotOptimize(value);
+            index = (index + 1) % individuals.size();
+        }
+        state.setItemsProcessed(state.iterations());
+    }
+    GA_BENCHMARK(BM_DecodeToValue)->Args({8})->Args({16})->Args({32})->Args({48})->Args({62});
+
+    // Population operations
+
+    void BM_TournamentSelection(State& state) {
+        std::unique_ptr<GeneticAlgorithm> ga = makeEvaluatedEngine(
+            static_cast<int>(state.range(0)), static_cast<int>(state.range(1)), true);
+
+        while (state.keepRunning()) {
+            Individual selected = ga->tournamentSelection(3);
+            doNotOptimize(selected);
+        }
+        state.setItemsProcessed(state.iterations());
+    }
+    GA_BENCHMARK(BM_TournamentSelection)->ArgsProduct({{50, 500, 5000}, {20, 64}});
+
+    void BM_RouletteWheelSelection(State& state) {
+        std::unique_ptr<GeneticAlgorithm> ga = makeEvaluatedEngine(
+            static_cast<int>(state.range(0)), static_cast<int>(state.range(1)), true);
+
+        while (state.keepRunning()) {
+            Individual selected = ga->rouletteWheelSelection();
+            doNotOptimize(selected);
+        }
+        state.setItemsProcessed(state.iterations());
+    }
+    GA_BENCHMARK(BM_RouletteWheelSelection)->ArgsProduct({{50, 500, 5000}, {20, 64}});
+
+    // Minimization takes a separate code path in roulette selection
+    void BM_RouletteWheelSelectionMinimize(State& state) {
+        std::unique_ptr<GeneticAlgorithm> ga = makeEvaluatedEngine(
+            static_cast<int>(state.range(0)), static_cast<int>(state.range(1)), false);
+
+        while (state.keepRunning()) {
+            Individual selected = ga->rouletteWheelSelection();
+            doNotOptimize(selected);
+        }
+        state.setItemsProcessed(state.iterations());
+    }
+    GA_BENCHMARK(BM_RouletteWheelSelectionMinimize)->ArgsProduct({{50, 200, 1000}, {20}});
+
+    void BM_CalculatePopulationDiversity(State& state) {
+        int populationSize = static_cast<int>(state.range(0));
+        std::unique_ptr<GeneticAlgorithm> ga = makeEvaluatedEngine(
+            populationSize, static_cast<int>(state.range(1)), true);
+
+        while (state.keepRunning()) {
+            double diversity = ga->calculatePopulationDiversity();
+            doNotOptimize(diversity);
+        }
+        state.setItemsProcessed(state.iterations() * populationSize);
+    }
+    GA_BENCHMARK(BM_CalculatePopulationDiversity)->ArgsProduct({{50, 200, 1000}, {20, 64}});
+
+    void BM_SortPopulationByFitness(State& state) {
+        int populationSize = static_cast<int>(state.range(0));
+        std::unique_ptr<GeneticAlgorithm> ga = makeEvaluatedEngine(
+            populationSize, static_cast<int>(state.range(1)), true);
+
+        while (state.keepRunning()) {
+            // Re-create an unsorted population outside the timed region
+            state.pauseTiming();
+            ga->initializePopulation();
+            ga->evaluatePopulation();
+            state.resumeTiming();
+
+            ga->sortPopulationByFitness();
+        }
+        state.setItemsProcessed(state.iterations() * populationSize);
+    }
+    GA_BENCHMARK(BM_SortPopulationByFitness)->ArgsProduct({{50, 500, 5000}, {20, 64}});
+
+    // Built-in fitness functions (evaluated over a fixed batch of points)
+
+    const int EVALUATION_BATCH = 1024;
+
+    void runEvaluateBenchmark(State& state, const FitnessFunction& function) {
+        std::vector<double> points(EVALUATION_BATCH);
+        std::mt19937 rng(BENCHMARK_SEED);
+        std::uniform_real_distribution<double> dist(-10.0, 10.0);
+        for (double& point : points) {
+            point = dist(rng);
+        }
+
+        while (state.keepRunning()) {
+            double sum = 0.0;
+            for (double point : points) {
+                sum += function.evaluate(point);
+            }
+            doNotOptimize(sum);
+        }
+        state.setItemsProcessed(state.iterations() * EVALUATION_BATCH);
+    }
+
+    void BM_EvaluateQuadratic(State& state) {
+        runEvaluateBenchmark(state, QuadraticFunction(1.0, -2.0, 1.0));
+    }
+    GA_BENCHMARK(BM_EvaluateQuadratic);
+
+    void BM_EvaluateSinusoidal(State& state) {
+        runEvaluateBenchmark(state, SinusoidalFunction(2.0, 0.5, 0.0, 1.0));
+    }
+    GA_BENCHMARK(BM_EvaluateSinusoidal);
+
+    void BM_EvaluateRastrigin(State& state) {
+        runEvaluateBenchmark(state, RastriginFunction(10.0));
+    }
+    GA_BENCHMARK(BM_EvaluateRastrigin);
+
+    void BM_EvaluatePolynomial(State& state) {
+        runEvaluateBenchmark(state, PolynomialFunction(1.0, -2.0, 0.5, 3.0));
+    }
+    GA_BENCHMARK(BM_EvaluatePolynomial);
+
+    void BM_EvaluateExponential(State& state) {
+        runEvaluateBenchmark(state, ExponentialFunction(1.0, 0.1, 0.0));
+    }
+    GA_BENCHMARK(BM_EvaluateExponential);
+
+    void BM_EvaluateLinear(State& state) {
+        runEvaluateBenchmark(state, LinearFunction(2.0, 1.0));
+    }
+    GA_BENCHMARK(BM_EvaluateLinear);
+
+    void BM_EvaluateCosine(State& state) {
+        runEvaluateBenchmark(state, CosineFunction(1.0, 1.0, 0.0, 0.0));
+    }
+    GA_BENCHMARK(BM_EvaluateCosine);
+}
+
+int main(int argc, char** argv) {
+    return GA::Bench::runBenchmarks(argc, argv);
+}
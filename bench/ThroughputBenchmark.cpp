@@ -0,0 +1,423 @@
+#include "GeneticAlgorithm.h"
+#include "FitnessFunction.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <psapi.h>
+#endif
+
+/**
+ * @file ThroughputBenchmark.cpp
+ * @brief End-to-end throughput benchmark for GeneticAlgorithm::run()
+ *
+ * Runs fixed-seed workloads covering every built-in function, every
+ * selection/crossover combination and a population-size sweep, then reports
+ * generations/s, evaluations/s, peak RSS and time-to-target-fitness as JSON.
+ * With --compare=baseline.json the results are checked against a stored
+ * baseline and regressions beyond --threshold are reported (exit code 2).
+ */
+
+using namespace GA;
+
+namespace {
+    const unsigned int WORKLOAD_SEED = 20240601;
+
+    /**
+     * @class CountingFunction
+     * @brief Fitness function decorator that counts evaluate() calls
+     */
+    class CountingFunction : public FitnessFunction {
+    private:
+        std::unique_ptr<FitnessFunction> inner;
+        std::shared_ptr<std::atomic<uint64_t>> counter;
+
+    public:
+        CountingFunction(std::unique_ptr<FitnessFunction> function, std::shared_ptr<std::atomic<uint64_t>> sharedCounter)
+            : FitnessFunction(function->getName(), function->getExpression(), function->isMaximizationProblem()),
+              inner(std::move(function)), counter(std::move(sharedCounter)) {
+        }
+
+        double evaluate(double x) const override {
+            counter->fetch_add(1, std::memory_order_relaxed);
+            return inner->evaluate(x);
+        }
+
+        double getOptimalValue() const override { return inner->getOptimalValue(); }
+        double getOptimalX() const override { return inner->getOptimalX(); }
+        std::pair<double, double> getTheoreticalRange(double minValue, double maxValue) const override {
+            return inner->getTheoreticalRange(minValue, maxValue);
+        }
+
+        std::unique_ptr<FitnessFunction> clone() const override {
+            return std::make_unique<CountingFunction>(inner->clone(), counter);
+        }
+    };
+
+    struct Workload {
+        std::string name;
+        std::string functionKey;
+        SelectionType selection;
+        CrossoverType crossover;
+        int populationSize;
+        int generations;
+    };
+
+    struct WorkloadResult {
+        Workload workload;
+        int generationsRun;
+        double seconds;
+        double generationsPerSecond;
+        double evaluationsPerSecond;
+        uint64_t evaluations;
+        long long peakRssKb;
+        double timeToTargetSeconds;                // Negative when the target was not reached
+        int targetGeneration;                      // -1 when the target was not reached
+        double bestFitness;
+    };
+
+    std::unique_ptr<FitnessFunction> makeFunction(const std::string& key) {
+        if (key == "sinusoidal") return std::make_unique<SinusoidalFunction>(2.0, 0.5, 0.0, 1.0, true);
+        if (key == "cosine") return std::make_unique<CosineFunction>(1.0, 1.0, 0.0, 0.0, true);
+        if (key == "rastrigin") return std::make_unique<RastriginFunction>(10.0, false);
+        if (key == "polynomial") return std::make_unique<PolynomialFunction>(1.0, -2.0, 0.5, 3.0, true);
+        if (key == "exponential") return std::make_unique<ExponentialFunction>(1.0, 0.1, 0.0, true);
+        if (key == "linear") return std::make_unique<LinearFunction>(2.0, 1.0, true);
+        if (key == "quadratic") return std::make_unique<QuadraticFunction>(1.0, -2.0, 1.0, false);
+        throw std::invalid_argument("Unknown function: " + key);
+    }
+
+    const char* selectionName(SelectionType type) {
+        switch (type) {
+            case SelectionType::ROULETTE_WHEEL: return "roulette";
+            case SelectionType::TOURNAMENT: return "tournament";
+            case SelectionType::ELITISM: return "elitism";
+        }
+        return "unknown";
+    }
+
+    const char* crossoverName(CrossoverType type) {
+        switch (type) {
+            case CrossoverType::SINGLE_POINT: return "single";
+            case CrossoverType::TWO_POINT: return "two";
+            case CrossoverType::UNIFORM: return "uniform";
+        }
+        return "unknown";
+    }
+
+    std::vector<Workload> buildWorkloads(bool includeLarge) {
+        std::vector<Workload> workloads;
+        const int generations = 50;
+
+        // Every built-in function with the default operators
+        const char* functions[] = {"sinusoidal", "cosine", "rastrigin", "polynomial", "exponential", "linear", "quadratic"};
+        for (const char* function : functions) {
+            workloads.push_back({std::string("function/") + function, function,
+                                 SelectionType::TOURNAMENT, CrossoverType::SINGLE_POINT, 200, generations});
+        }
+
+        // Every selection/crossover combination on one function
+        SelectionType selections[] = {SelectionType::TOURNAMENT, SelectionType::ROULETTE_WHEEL, SelectionType::ELITISM};
+        CrossoverType crossovers[] = {CrossoverType::SINGLE_POINT, CrossoverType::TWO_POINT, CrossoverType::UNIFORM};
+        for (SelectionType selection : selections) {
+            for (CrossoverType crossover : crossovers) {
+                workloads.push_back({std::string("operators/") + selectionName(selection) + "/" + crossoverName(crossover),
+                                     "sinusoidal", selection, crossover, 200, generations});
+            }
+        }
+
+        // Population size sweep (the large tiers take long while diversity is quadratic)
+        std::vector<int> sizes = {50, 500, 5000};
+        if (includeLarge) {
+            sizes.push_back(50000);
+            sizes.push_back(1000000);
+        }
+        for (int size : sizes) {
+            workloads.push_back({"population/" + std::to_string(size), "rastrigin",
+                                 SelectionType::TOURNAMENT, CrossoverType::SINGLE_POINT, size,
+                                 size > 5000 ? 5 : generations});
+        }
+
+        return workloads;
+    }
+
+    // Resets the peak RSS counter where the platform allows it
+    void resetPeakRss() {
+        #ifdef __linux__
+        std::ofstream clearRefs("/proc/self/clear_refs");
+        if (clearRefs) {
+            clearRefs << "5";
+        }
+        #endif
+    }
+
+    long long readPeakRssKb() {
+        #ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return static_cast<long long>(counters.PeakWorkingSetSize / 1024);
+        }
+        return -1;
+        #else
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            if (line.compare(0, 6, "VmHWM:") == 0) {
+                return std::atoll(line.c_str() + 6);
+            }
+        }
+        return -1;
+        #endif
+    }
+
+    // Best attainable fitness over the domain (known optimum or theoretical range)
+    double targetFitness(const FitnessFunction& function, const GAConfig& config) {
+        double optimum = function.getOptimalValue();
+        if (std::isnan(optimum)) {
+            optimum = function.getTheoreticalRange(config.minValue, config.maxValue).first;
+        }
+        return optimum;
+    }
+
+    WorkloadResult runWorkload(const Workload& workload) {
+        GAConfig config;
+        config.populationSize = workload.populationSize;
+        config.chromosomeLength = 20;
+        config.maxGenerations = workload.generations;
+        config.selectionType = workload.selection;
+        config.crossoverType = workload.crossover;
+        config.randomSeed = WORKLOAD_SEED;
+
+        std::shared_ptr<std::atomic<uint64_t>> counter = std::make_shared<std::atomic<uint64_t>>(0);
+        std::unique_ptr<FitnessFunction> function = makeFunction(workload.functionKey);
+        config.isMaximization = function->isMaximizationProblem();
+        double target = targetFitness(*function, config);
+        double tolerance = 1e-6 * std::max(1.0, std::abs(target));
+
+        GeneticAlgorithm ga(config, std::make_unique<CountingFunction>(std::move(function), counter));
+
+        WorkloadResult result;
+        result.workload = workload;
+        result.timeToTargetSeconds = -1.0;
+        result.targetGeneration = -1;
+
+        resetPeakRss();
+        auto startTime = std::chrono::steady_clock::now();
+        GenerationStats finalStats = ga.run([&](int generation, const GenerationStats& stats) {
+            if (result.targetGeneration < 0) {
+                bool reached = config.isMaximization ? (stats.bestFitness >= target - tolerance)
+                                                     : (stats.bestFitness <= target + tolerance);
+                if (reached) {
+                    result.targetGeneration = generation;
+                    result.timeToTargetSeconds = std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - startTime).count();
+                }
+            }
+        });
+        auto endTime = std::chrono::steady_clock::now();
+
+        result.seconds = std::chrono::duration<double>(endTime - startTime).count();
+        result.generationsRun = finalStats.generation;
+        result.evaluations = counter->load();
+        result.generationsPerSecond = result.seconds > 0.0 ? result.generationsRun / result.seconds : 0.0;
+        result.evaluationsPerSecond = result.seconds > 0.0 ? result.evaluations / result.seconds : 0.0;
+        result.peakRssKb = readPeakRssKb();
+        result.bestFitness = finalStats.bestFitness;
+        return result;
+    }
+
+    // One result object per line so baselines can be read back without a JSON library
+    void writeJson(const std::string& path, const std::vector<WorkloadResult>& results) {
+        FILE* file = std::fopen(path.c_str(), "w");
+        if (!file) {
+            throw std::runtime_error("Cannot write results to " + path);
+        }
+        std::fprintf(file, "{\n  \"schema\": 1,\n  \"seed\": %u,\n  \"results\": [\n", WORKLOAD_SEED);
+        for (size_t i = 0; i < results.size(); ++i) {
+            const WorkloadResult& r = results[i];
+            std::fprintf(file,
+                         "    {\"name\": \"%s\", \"function\": \"%s\", \"selection\": \"%s\", \"crossover\": \"%s\", "
+                         "\"population\": %d, \"generations\": %d, \"seconds\": %.6f, "
+                         "\"generations_per_second\": %.3f, \"evaluations\": %llu, \"evaluations_per_second\": %.3f, "
+                         "\"peak_rss_kb\": %lld, \"time_to_target_seconds\": ",
+                         r.workload.name.c_str(), r.workload.functionKey.c_str(), selectionName(r.workload.selection),
+                         crossoverName(r.workload.crossover), r.workload.populationSize, r.generationsRun, r.seconds,
+                         r.generationsPerSecond, static_cast<unsigned long long>(r.evaluations),
+                         r.evaluationsPerSecond, r.peakRssKb);
+            if (r.targetGeneration >= 0) {
+                std::fprintf(file, "%.6f, \"target_generation\": %d", r.timeToTargetSeconds, r.targetGeneration);
+            } else {
+                std::fprintf(file, "null, \"target_generation\": null");
+            }
+            std::fprintf(file, ", \"best_fitness\": %.17g}%s\n", r.bestFitness, (i + 1 < results.size()) ? "," : "");
+        }
+        std::fprintf(file, "  ]\n}\n");
+        std::fclose(file);
+    }
+
+    bool extractNumber(const std::string& line, const std::string& key, double& value) {
+        size_t position = line.find("\"" + key + "\":");
+        if (position == std::string::npos) {
+            return false;
+        }
+        const char* start = line.c_str() + position + key.size() + 3;
+        char* end = nullptr;
+        value = std::strtod(start, &end);
+        return end != start;
+    }
+
+    bool extractString(const std::string& line, const std::string& key, std::string& value) {
+        size_t position = line.find("\"" + key + "\": \"");
+        if (position == std::string::npos) {
+            return false;
+        }
+        size_t start = position + key.size() + 5;
+        size_t end = line.find('"', start);
+        if (end == std::string::npos) {
+            return false;
+        }
+        value = line.substr(start, end - start);
+        return true;
+    }
+
+    // Baseline throughput per workload name
+    std::map<std::string, std::pair<double, double>> readBaseline(const std::string& path) {
+        std::ifstream input(path);
+        if (!input) {
+            throw std::runtime_error("Cannot read baseline " + path);
+        }
+        std::map<std::string, std::pair<double, double>> baseline;
+        std::string line;
+        while (std::getline(input, line)) {
+            std::string name;
+            double generationsPerSecond, evaluationsPerSecond;
+            if (extractString(line, "name", name) &&
+                extractNumber(line, "generations_per_second", generationsPerSecond) &&
+                extractNumber(line, "evaluations_per_second", evaluationsPerSecond)) {
+                baseline[name] = std::make_pair(generationsPerSecond, evaluationsPerSecond);
+            }
+        }
+        return baseline;
+    }
+
+    int compareWithBaseline(const std::vector<WorkloadResult>& results, const std::string& path, double threshold) {
+        std::map<std::string, std::pair<double, double>> baseline = readBaseline(path);
+        int regressions = 0;
+
+        std::cout << std::endl << "Comparison against " << path << " (threshold " << threshold * 100 << "%)" << std::endl;
+        for (const WorkloadResult& r : results) {
+            auto entry = baseline.find(r.workload.name);
+            if (entry == baseline.end() || entry->second.first <= 0.0) {
+                std::cout << "  " << std::left << std::setw(36) << r.workload.name << " no baseline" << std::endl;
+                continue;
+            }
+
+            // The worse of the two throughput changes decides
+            double change = r.generationsPerSecond / entry->second.first - 1.0;
+            if (entry->second.second > 0.0) {
+                change = std::min(change, r.evaluationsPerSecond / entry->second.second - 1.0);
+            }
+            bool regressed = change < -threshold;
+            regressions += regressed ? 1 : 0;
+            std::cout << "  " << std::left << std::setw(36) << r.workload.name << std::right
+                      << std::setw(9) << std::fixed << std::setprecision(1) << change * 100 << "%"
+                      << (regressed ? "  REGRESSION" : (change > threshold ? "  improved" : "")) << std::endl;
+        }
+
+        std::cout << regressions << " regression(s) beyond threshold" << std::endl;
+        return regressions > 0 ? 2 : 0;
+    }
+
+    void printUsage(const char* program) {
+        std::cerr << "Usage: " << program << " [--filter=substring] [--large] [--repetitions=N]"
+                  << " [--json=path] [--compare=baseline.json] [--threshold=0.10]" << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    std::string filter;
+    std::string jsonPath = "throughput_results.json";
+    std::string baselinePath;
+    double threshold = 0.10;
+    int repetitions = 3;
+    bool includeLarge = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument.compare(0, 9, "--filter=") == 0) {
+            filter = argument.substr(9);
+        } else if (argument == "--large") {
+            includeLarge = true;
+        } else if (argument.compare(0, 14, "--repetitions=") == 0) {
+            repetitions = std::max(1, std::atoi(argument.substr(14).c_str()));
+        } else if (argument.compare(0, 7, "--json=") == 0) {
+            jsonPath = argument.substr(7);
+        } else if (argument.compare(0, 10, "--compare=") == 0) {
+            baselinePath = argument.substr(10);
+        } else if (argument.compare(0, 12, "--threshold=") == 0) {
+            threshold = std::atof(argument.substr(12).c_str());
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    try {
+        std::vector<WorkloadResult> results;
+        std::cout << std::left << std::setw(36) << "Workload" << std::right << std::setw(12) << "gen/s"
+                  << std::setw(14) << "eval/s" << std::setw(12) << "RSS (KB)" << std::setw(14) << "to target" << std::endl;
+        std::cout << std::string(88, '-') << std::endl;
+
+        for (const Workload& workload : buildWorkloads(includeLarge)) {
+            if (!filter.empty() && workload.name.find(filter) == std::string::npos) {
+                continue;
+            }
+
+            // Keep the median repetition (by wall time) to damp scheduling noise
+            std::vector<WorkloadResult> runs;
+            for (int r = 0; r < repetitions; ++r) {
+                runs.push_back(runWorkload(workload));
+            }
+            std::sort(runs.begin(), runs.end(), [](const WorkloadResult& a, const WorkloadResult& b) {
+                return a.seconds < b.seconds;
+            });
+            WorkloadResult result = runs[runs.size() / 2];
+            results.push_back(result);
+
+            std::ostringstream toTarget;
+            if (result.targetGeneration >= 0) {
+                toTarget << std::fixed << std::setprecision(4) << result.timeToTargetSeconds << " s";
+            } else {
+                toTarget << "-";
+            }
+            std::cout << std::left << std::setw(36) << workload.name << std::right << std::fixed
+                      << std::setprecision(1) << std::setw(12) << result.generationsPerSecond
+                      << std::setw(14) << std::setprecision(0) << result.evaluationsPerSecond
+                      << std::setw(12) << result.peakRssKb << std::setw(14) << toTarget.str() << std::endl;
+        }
+
+        writeJson(jsonPath, results);
+        std::cout << std::endl << "Results written to " << jsonPath << std::endl;
+
+        if (!baselinePath.empty()) {
+            return compareWithBaseline(results, baselinePath, threshold);
+        }
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -17,7 +17,7 @@ echo.
 echo Compiling source files...
 
 REM Compile all source files with required flags
-g++ -static-libgcc -static-libstdc++ -static -std=c++17 -Wall -Wextra -m64 -O2 -DUNICODE -D_UNICODE -I"src" -o "bin\GA_Demo.exe" "src\main.cpp" "src\Individual.cpp" "src\FitnessFunction.cpp" "src\GeneticAlgorithm.cpp" "src\ConsoleInterface.cpp"
+g++ -static-libgcc -static-libstdc++ -static -std=c++17 -Wall -Wextra -m64 -O2 -DUNICODE -D_UNICODE -I"src" -o "bin\GA_Demo.exe" "src\main.cpp" "src\Individual.cpp" "src\FitnessFunction.cpp" "src\GeneticAlgorithm.cpp" "src\Checkpoint.cpp" "src\StatisticsSink.cpp" "src\PopulationSnapshot.cpp" "src\Profiler.cpp" "src\EventTracer.cpp" "src\ThreadPool.cpp" "src\HardwareCounters.cpp" "src\StoppingCriteria.cpp" "src\PopulationIndex.cpp" "src\AsyncEvaluator.cpp" "src\ProcessFitnessFunction.cpp" "src\EvaluationLoop.cpp" "src\PopulationSummary.cpp" "src\LocalSearch.cpp" "src\RateControl.cpp" "src\RestartDriver.cpp" "src\Niching.cpp" "src\MultiObjective.cpp" "src\ConsoleInterface.cpp"
 
 REM Check if compilation was successful
 if %ERRORLEVEL% EQU 0 (
@@ -0,0 +1,40 @@
+@echo off
+REM Build script for the GA_Cpp benchmark suite using g++ (same flags as build.bat)
+REM Genetic Algorithm Demonstration - Andres Torres Ceja - UG DICIS
+
+echo ===============================================
+echo Building Genetic Algorithm Benchmarks
+echo ===============================================
+
+REM Create bin directory if it doesn't exist
+if not exist "bin" mkdir bin
+
+set GA_SOURCES="src\Individual.cpp" "src\FitnessFunction.cpp" "src\GeneticAlgorithm.cpp" "src\Checkpoint.cpp" "src\StatisticsSink.cpp" "src\PopulationSnapshot.cpp" "src\Profiler.cpp" "src\EventTracer.cpp" "src\ThreadPool.cpp" "src\HardwareCounters.cpp" "src\StoppingCriteria.cpp" "src\PopulationIndex.cpp" "src\AsyncEvaluator.cpp" "src\ProcessFitnessFunction.cpp" "src\EvaluationLoop.cpp" "src\PopulationSummary.cpp" "src\LocalSearch.cpp" "src\RateControl.cpp" "src\RestartDriver.cpp" "src\Niching.cpp" "src\MultiObjective.cpp"
+set GA_FLAGS=-static-libgcc -static-libstdc++ -static -std=c++17 -Wall -Wextra -m64 -O2 -DUNICODE -D_UNICODE -I"src" -I"bench"
+
+echo.
+echo Compiling microbenchmarks...
+g++ %GA_FLAGS% -o "bin\GA_MicroBench.exe" "bench\MicroBenchmarks.cpp" "bench\BenchmarkHarness.cpp" %GA_SOURCES%
+if %ERRORLEVEL% NEQ 0 goto failed
+
+echo.
+echo Compiling throughput benchmark...
+g++ %GA_FLAGS% -o "bin\GA_Throughput.exe" "bench\ThroughputBenchmark.cpp" %GA_SOURCES% -lpsapi
+if %ERRORLEVEL% NEQ 0 goto failed
+
+echo.
+echo ===============================================
+echo BUILD SUCCESSFUL!
+echo Microbenchmarks: bin\GA_MicroBench.exe [--filter=name] [--min_time=seconds] [--json=path]
+echo Throughput:      bin\GA_Throughput.exe [--large] [--json=path] [--compare=baseline.json] [--threshold=0.10]
+echo ===============================================
+echo.
+goto :eof
+
+:failed
+echo.
+echo ===============================================
+echo BUILD FAILED!
+echo Please check the error messages above.
+echo ===============================================
+echo.
@@ -0,0 +1,118 @@
+#include "AsyncEvaluator.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace GA {
+
+    // Constructor
+    AsyncEvaluator::AsyncEvaluator(int threadCount, EvaluateFunction evaluate)
+        : evaluate(std::move(evaluate)), inFlight(0), running(0), stopping(false) {
+        if (threadCount <= 0) {
+            threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+
+        workers.reserve(threadCount);
+        for (int worker = 1; worker <= threadCount; ++worker) {
+            workers.emplace_back(&AsyncEvaluator::workerLoop, this, worker);
+        }
+    }
+
+    // Destructor (candidates still queued are dropped)
+    AsyncEvaluator::~AsyncEvaluator() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        workAvailable.notify_all();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    int AsyncEvaluator::getThreadCount() const {
+        return static_cast<int>(workers.size());
+    }
+
+    // Worker: claim a candidate, evaluate it outside the lock, publish the result
+    void AsyncEvaluator::workerLoop(int worker) {
+        while (true) {
+            Individual individual;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                workAvailable.wait(lock, [&] { return stopping || !pending.empty(); });
+                if (stopping) {
+                    return;
+                }
+                individual = std::move(pending.front());
+                pending.pop_front();
+                running++;
+            }
+
+            std::exception_ptr evaluationError;
+            try {
+                individual.setFitness(evaluate(individual, worker));
+            } catch (...) {
+                evaluationError = std::current_exception();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                running--;
+                if (evaluationError) {
+                    inFlight--;
+                    if (!error) {
+                        error = evaluationError;
+                    }
+                } else {
+                    completed.push_back(std::move(individual));
+                }
+            }
+            resultAvailable.notify_all();
+        }
+    }
+
+    void AsyncEvaluator::submit(Individual individual) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.push_back(std::move(individual));
+            inFlight++;
+        }
+        workAvailable.notify_one();
+    }
+
+    Individual AsyncEvaluator::takeResult() {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (inFlight == 0 && !error) {
+            throw std::logic_error("No evaluations in flight");
+        }
+
+        resultAvailable.wait(lock, [&] { return !completed.empty() || error; });
+        if (error) {
+            std::exception_ptr evaluationError = error;
+            error = nullptr;
+            std::rethrow_exception(evaluationError);
+        }
+
+        Individual individual = std::move(completed.front());
+        completed.pop_front();
+        inFlight--;
+        return individual;
+    }
+
+    size_t AsyncEvaluator::getInFlight() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return inFlight;
+    }
+
+    size_t AsyncEvaluator::cancel() {
+        std::unique_lock<std::mutex> lock(mutex);
+        pending.clear();
+        resultAvailable.wait(lock, [&] { return running == 0; });
+
+        size_t discarded = completed.size();
+        completed.clear();
+        inFlight = 0;
+        error = nullptr;
+        return discarded;
+    }
+}
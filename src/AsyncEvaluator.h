@@ -0,0 +1,91 @@
+#ifndef ASYNC_EVALUATOR_H
+#define ASYNC_EVALUATOR_H
+
+#include "GeneticTypes.h"
+#include "Individual.h"
+#include <cstddef>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+namespace GA {
+    /**
+     * @class AsyncEvaluator
+     * @brief Worker threads that evaluate submitted individuals without a barrier
+     *
+     * The master thread submits candidates and takes back evaluated individuals
+     * in completion order, so a slow evaluation only occupies its own worker.
+     * Workers are numbered from 1 (0 is the submitting thread, as in ThreadPool).
+     */
+    class AsyncEvaluator {
+    public:
+        // Evaluation body: the individual to evaluate and the executing worker index
+        using EvaluateFunction = std::function<FitnessValue(const Individual& individual, int worker)>;
+
+    private:
+        std::vector<std::thread> workers;          // Evaluation threads
+        EvaluateFunction evaluate;                 // Fitness evaluation run by the workers
+        mutable std::mutex mutex;                  // Guards the queues and counters
+        std::condition_variable workAvailable;     // Signals a submitted candidate or shutdown
+        std::condition_variable resultAvailable;   // Signals a completed evaluation or an error
+        std::deque<Individual> pending;            // Submitted candidates not yet claimed by a worker
+        std::deque<Individual> completed;          // Evaluated individuals not yet taken back
+        size_t inFlight;                           // Submitted and not yet taken back
+        size_t running;                            // Candidates currently being evaluated
+        std::exception_ptr error;                  // First exception thrown by the evaluation
+        bool stopping;                             // Set on destruction
+
+        void workerLoop(int worker);
+
+    public:
+        /**
+         * @brief Starts the workers
+         * @param threadCount Number of evaluation threads (0 = hardware concurrency)
+         * @param evaluate Thread-safe fitness evaluation
+         */
+        AsyncEvaluator(int threadCount, EvaluateFunction evaluate);
+        ~AsyncEvaluator();
+
+        AsyncEvaluator(const AsyncEvaluator&) = delete;
+        AsyncEvaluator& operator=(const AsyncEvaluator&) = delete;
+
+        /**
+         * @brief Gets the number of evaluation threads
+         * @return Worker count
+         */
+        int getThreadCount() const;
+
+        /**
+         * @brief Queues a candidate for evaluation
+         * @param individual Candidate (its fitness is set by a worker)
+         */
+        void submit(Individual individual);
+
+        /**
+         * @brief Waits for the next completed evaluation
+         * @return Evaluated individual, in completion order
+         *
+         * Rethrows the first exception thrown by the evaluation; throws
+         * std::logic_error if nothing is in flight.
+         */
+        Individual takeResult();
+
+        /**
+         * @brief Gets the number of candidates submitted and not yet taken back
+         * @return Candidates in flight
+         */
+        size_t getInFlight() const;
+
+        /**
+         * @brief Drops queued candidates, waits for running ones and discards all results
+         * @return Number of evaluations that completed but were discarded
+         */
+        size_t cancel();
+    };
+}
+
+#endif // ASYNC_EVALUATOR_H
@@ -0,0 +1,203 @@
+#ifndef ASYNC_FITNESS_H
+#define ASYNC_FITNESS_H
+
+#include "FitnessFunction.h"
+#include "EvaluationLoop.h"
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @file AsyncFitness.h
+ * @brief C++20 coroutine interface for latency-bound fitness functions
+ *
+ * Objectives derive from CoroutineFitnessFunction and implement evaluateTask
+ * as a coroutine that co_awaits sleepFor / readable (or other FitnessTasks).
+ * evaluatePopulation then starts every pending evaluation on one
+ * EvaluationLoop and waits for them together. The header compiles to nothing
+ * without coroutine support, so C++17 builds are unaffected.
+ */
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define GA_HAS_COROUTINES 1
+
+namespace GA {
+    /**
+     * @class FitnessTask
+     * @brief Lazily started coroutine producing a fitness value
+     */
+    class FitnessTask {
+    public:
+        struct promise_type {
+            FitnessValue value = 0.0;              // Result set by co_return
+            std::exception_ptr error;              // Exception that escaped the coroutine
+            std::coroutine_handle<> continuation;  // Coroutine awaiting this task
+
+            FitnessTask get_return_object() {
+                return FitnessTask(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() noexcept { return {}; }
+
+            // Hand control straight back to the awaiting coroutine
+            auto final_suspend() noexcept {
+                struct FinalAwaiter {
+                    bool await_ready() noexcept { return false; }
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+                        std::coroutine_handle<> next = handle.promise().continuation;
+                        return next ? next : std::noop_coroutine();
+                    }
+                    void await_resume() noexcept {}
+                };
+                return FinalAwaiter{};
+            }
+
+            void return_value(FitnessValue fitness) { value = fitness; }
+            void unhandled_exception() { error = std::current_exception(); }
+        };
+
+        FitnessTask(FitnessTask&& other) noexcept : handle(std::exchange(other.handle, {})) {}
+        FitnessTask(const FitnessTask&) = delete;
+        FitnessTask& operator=(const FitnessTask&) = delete;
+        FitnessTask& operator=(FitnessTask&&) = delete;
+
+        ~FitnessTask() {
+            if (handle) {
+                handle.destroy();
+            }
+        }
+
+        bool await_ready() const noexcept { return false; }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+
+        FitnessValue await_resume() {
+            if (handle.promise().error) {
+                std::rethrow_exception(handle.promise().error);
+            }
+            return handle.promise().value;
+        }
+
+    private:
+        explicit FitnessTask(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+
+        std::coroutine_handle<promise_type> handle;
+    };
+
+    /**
+     * @brief Suspends an evaluation for a while without blocking the loop
+     * @param loop Loop the evaluation runs on
+     * @param delay Time to wait
+     * @return Awaitable
+     */
+    inline auto sleepFor(EvaluationLoop& loop, EvaluationLoop::Clock::duration delay) {
+        struct SleepAwaiter {
+            EvaluationLoop& loop;
+            EvaluationLoop::Clock::duration delay;
+
+            bool await_ready() const noexcept { return delay <= EvaluationLoop::Clock::duration::zero(); }
+            void await_suspend(std::coroutine_handle<> handle) {
+                loop.postAfter(delay, [handle] { handle.resume(); });
+            }
+            void await_resume() const noexcept {}
+        };
+        return SleepAwaiter{loop, delay};
+    }
+
+    /**
+     * @brief Suspends an evaluation until a descriptor is readable (POSIX)
+     * @param loop Loop the evaluation runs on
+     * @param fd File descriptor (e.g. a socket to a local service)
+     * @return Awaitable (throws std::runtime_error where unsupported)
+     */
+    inline auto readable(EvaluationLoop& loop, int fd) {
+        struct ReadableAwaiter {
+            EvaluationLoop& loop;
+            int fd;
+
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) {
+                if (!loop.postWhenReadable(fd, [handle] { handle.resume(); })) {
+                    throw std::runtime_error("Waiting for descriptors is not supported on this platform");
+                }
+            }
+            void await_resume() const noexcept {}
+        };
+        return ReadableAwaiter{loop, fd};
+    }
+
+    /**
+     * @class CoroutineFitnessFunction
+     * @brief Base class for objectives written as coroutines
+     *
+     * evaluateTask runs on the EvaluationLoop thread; it must not block, only
+     * co_await. evaluate() drives a private loop for one value.
+     */
+    class CoroutineFitnessFunction : public FitnessFunction {
+    private:
+        // Eagerly started, self-destroying coroutine that reports a task's result
+        struct DetachedTask {
+            struct promise_type {
+                DetachedTask get_return_object() noexcept { return {}; }
+                std::suspend_never initial_suspend() noexcept { return {}; }
+                std::suspend_never final_suspend() noexcept { return {}; }
+                void return_void() noexcept {}
+                void unhandled_exception() noexcept { std::terminate(); }
+            };
+        };
+
+        static DetachedTask drive(FitnessTask task, EvaluationCompletion done) {
+            FitnessValue fitness = 0.0;
+            std::exception_ptr error;
+            try {
+                fitness = co_await task;
+            } catch (...) {
+                error = std::current_exception();
+            }
+            done(fitness, error);
+        }
+
+    public:
+        using FitnessFunction::FitnessFunction;
+
+        /**
+         * @brief Evaluates x as a coroutine
+         * @param x The input value to the function
+         * @param loop Loop to await timers and descriptors on
+         * @return Task producing the fitness value
+         */
+        virtual FitnessTask evaluateTask(double x, EvaluationLoop& loop) const = 0;
+
+        bool supportsAsyncEvaluation() const override { return true; }
+
+        void evaluateAsync(double x, EvaluationLoop& loop, EvaluationCompletion done) const override {
+            drive(evaluateTask(x, loop), std::move(done));
+        }
+
+        double evaluate(double x) const override {
+            EvaluationLoop loop;
+            bool finished = false;
+            FitnessValue result = 0.0;
+            std::exception_ptr failure;
+            evaluateAsync(x, loop, [&](FitnessValue fitness, std::exception_ptr error) {
+                result = fitness;
+                failure = error;
+                finished = true;
+            });
+            loop.runUntil([&] { return finished; });
+
+            if (failure) {
+                std::rethrow_exception(failure);
+            }
+            return result;
+        }
+    };
+}
+
+#endif // coroutine support
+
+#endif // ASYNC_FITNESS_H
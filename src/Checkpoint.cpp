@@ -0,0 +1,449 @@
+#include "Checkpoint.h"
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+namespace GA {
+
+    namespace {
+        // Appends plain values to a byte buffer so the file is written with one call
+        class BinaryWriter {
+        private:
+            std::vector<char>& buffer;
+
+        public:
+            explicit BinaryWriter(std::vector<char>& target) : buffer(target) {}
+
+            void writeBytes(const void* data, size_t size) {
+                const char* bytes = static_cast<const char*>(data);
+                buffer.insert(buffer.end(), bytes, bytes + size);
+            }
+
+            template <typename T>
+            void write(const T& value) {
+                writeBytes(&value, sizeof(T));
+            }
+
+            void writeString(const std::string& value) {
+                write(static_cast<uint32_t>(value.size()));
+                writeBytes(value.data(), value.size());
+            }
+
+            template <typename T>
+            void writeVector(const std::vector<T>& values) {
+                write(static_cast<uint64_t>(values.size()));
+                writeBytes(values.data(), values.size() * sizeof(T));
+            }
+        };
+
+        // Reads plain values back from a byte buffer with bounds checking
+        class BinaryReader {
+        private:
+            const std::vector<char>& buffer;
+            size_t position;
+
+        public:
+            explicit BinaryReader(const std::vector<char>& source) : buffer(source), position(0) {}
+
+            void readBytes(void* data, size_t size) {
+                if (size > buffer.size() - position) {
+                    throw std::runtime_error("Checkpoint file is truncated");
+                }
+                std::memcpy(data, buffer.data() + position, size);
+                position += size;
+            }
+
+            template <typename T>
+            T read() {
+                T value;
+                readBytes(&value, sizeof(T));
+                return value;
+            }
+
+            std::string readString() {
+                uint32_t size = read<uint32_t>();
+                std::string value(size, '\0');
+                readBytes(&value[0], size);
+                return value;
+            }
+
+            template <typename T>
+            void readVector(std::vector<T>& values) {
+                uint64_t size = read<uint64_t>();
+                if (size > (buffer.size() - position) / sizeof(T)) {
+                    throw std::runtime_error("Checkpoint file is truncated");
+                }
+                values.resize(static_cast<size_t>(size));
+                readBytes(values.data(), values.size() * sizeof(T));
+            }
+        };
+
+        // Only the parameters that influence the evolution are persisted;
+        // output paths stay with the configuration of the resuming process
+        void writeConfig(BinaryWriter& out, const GAConfig& config) {
+            out.write(static_cast<int32_t>(config.populationSize));
+            out.write(static_cast<int32_t>(config.chromosomeLength));
+            out.write(static_cast<int32_t>(config.maxGenerations));
+            out.write(config.crossoverRate);
+            out.write(config.mutationRate);
+            out.write(config.elitismRate);
+            out.write(static_cast<uint8_t>(config.isMaximization));
+            out.write(static_cast<int32_t>(config.selectionType));
+            out.write(static_cast<int32_t>(config.crossoverType));
+            out.write(static_cast<int32_t>(config.tournamentSize));
+            out.write(config.minValue);
+            out.write(config.maxValue);
+            out.write(static_cast<uint32_t>(config.randomSeed));
+            out.write(static_cast<int32_t>(config.evolutionMode));
+            out.write(static_cast<int32_t>(config.steadyStateOffspring));
+            out.write(static_cast<int32_t>(config.replacementStrategy));
+            out.write(static_cast<int32_t>(config.breedingChunkSize));
+            out.write(static_cast<uint8_t>(config.adaptiveRefinement));
+            out.write(config.refinementConcentration);
+            out.write(config.refinementShrink);
+            out.write(static_cast<int32_t>(config.refinementBits));
+            out.write(config.targetPrecision);
+            out.write(static_cast<int32_t>(config.localSearch));
+            out.write(static_cast<int32_t>(config.localSearchInterval));
+            out.write(static_cast<int32_t>(config.localSearchElites));
+            out.write(static_cast<int32_t>(config.localSearchEvaluations));
+            out.write(static_cast<int32_t>(config.rateControl));
+            out.write(config.finalMutationRate);
+            out.write(config.finalCrossoverRate);
+            out.write(config.targetDiversity);
+            out.write(config.rateAdaptationFactor);
+            out.write(config.minMutationRate);
+            out.write(config.maxMutationRate);
+            out.write(static_cast<int32_t>(config.niching));
+            out.write(config.nicheRadius);
+            out.write(config.sharingAlpha);
+            out.write(static_cast<int32_t>(config.nicheCapacity));
+        }
+
+        void readConfig(BinaryReader& in, GAConfig& config, uint32_t version) {
+            config.populationSize = in.read<int32_t>();
+            config.chromosomeLength = in.read<int32_t>();
+            config.maxGenerations = in.read<int32_t>();
+            config.crossoverRate = in.read<double>();
+            config.mutationRate = in.read<double>();
+            config.elitismRate = in.read<double>();
+            config.isMaximization = in.read<uint8_t>() != 0;
+            config.selectionType = static_cast<SelectionType>(in.read<int32_t>());
+            config.crossoverType = static_cast<CrossoverType>(in.read<int32_t>());
+            config.tournamentSize = in.read<int32_t>();
+            config.minValue = in.read<double>();
+            config.maxValue = in.read<double>();
+            config.randomSeed = in.read<uint32_t>();
+            
+            // Version 1 predates the steady-state mode and keeps the defaults
+            if (version >= 2) {
+                config.evolutionMode = static_cast<EvolutionMode>(in.read<int32_t>());
+                config.steadyStateOffspring = in.read<int32_t>();
+                config.replacementStrategy = static_cast<ReplacementStrategy>(in.read<int32_t>());
+            }
+            
+            // Versions before 3 always bred serially
+            if (version >= 3) {
+                config.breedingChunkSize = in.read<int32_t>();
+            }
+            
+            // Versions before 4 predate adaptive domain refinement
+            if (version >= 4) {
+                config.adaptiveRefinement = in.read<uint8_t>() != 0;
+                config.refinementConcentration = in.read<double>();
+                config.refinementShrink = in.read<double>();
+                config.refinementBits = in.read<int32_t>();
+                config.targetPrecision = in.read<double>();
+            }
+            
+            // Versions before 5 predate memetic local search
+            if (version >= 5) {
+                config.localSearch = static_cast<LocalSearchType>(in.read<int32_t>());
+                config.localSearchInterval = in.read<int32_t>();
+                config.localSearchElites = in.read<int32_t>();
+                config.localSearchEvaluations = in.read<int32_t>();
+            }
+            
+            // Versions before 6 predate operator rate control
+            if (version >= 6) {
+                config.rateControl = static_cast<RateControlType>(in.read<int32_t>());
+                config.finalMutationRate = in.read<double>();
+                config.finalCrossoverRate = in.read<double>();
+                config.targetDiversity = in.read<double>();
+                config.rateAdaptationFactor = in.read<double>();
+                config.minMutationRate = in.read<double>();
+                config.maxMutationRate = in.read<double>();
+            }
+            
+            // Versions before 7 predate niching
+            if (version >= 7) {
+                config.niching = static_cast<NichingType>(in.read<int32_t>());
+                config.nicheRadius = in.read<double>();
+                config.sharingAlpha = in.read<double>();
+                config.nicheCapacity = in.read<int32_t>();
+            }
+        }
+
+        void writeStats(BinaryWriter& out, const GenerationStats& stats) {
+            out.write(static_cast<int32_t>(stats.generation));
+            out.write(stats.bestFitness);
+            out.write(stats.averageFitness);
+            out.write(stats.worstFitness);
+            out.write(stats.bestValue);
+            out.write(stats.convergence);
+            out.write(stats.bestFitnessPercentage);
+            out.write(stats.averageFitnessPercentage);
+        }
+
+        GenerationStats readStats(BinaryReader& in) {
+            GenerationStats stats;
+            stats.generation = in.read<int32_t>();
+            stats.bestFitness = in.read<double>();
+            stats.averageFitness = in.read<double>();
+            stats.worstFitness = in.read<double>();
+            stats.bestValue = in.read<double>();
+            stats.convergence = in.read<double>();
+            stats.bestFitnessPercentage = in.read<double>();
+            stats.averageFitnessPercentage = in.read<double>();
+            return stats;
+        }
+    }
+
+    // Serialize a snapshot and replace the destination file atomically
+    void Checkpoint::save(const CheckpointData& data, const std::string& path) {
+        std::vector<char> buffer;
+        buffer.reserve(256 + data.packedChromosomes.size() * sizeof(uint64_t) +
+                       data.populationSize() * (2 * sizeof(double) + 1) +
+                       data.selfAdaptiveRates.size() * sizeof(double) +
+                       data.statistics.size() * sizeof(GenerationStats) +
+                       data.rngState.size() * sizeof(uint32_t));
+
+        BinaryWriter out(buffer);
+        out.write(MAGIC);
+        out.write(VERSION);
+        writeConfig(out, data.config);
+        out.write(static_cast<int32_t>(data.generation));
+        out.writeString(data.functionName);
+        out.writeString(data.functionExpression);
+        out.writeVector(data.rngState);
+        out.write(static_cast<int32_t>(data.chromosomeLength));
+        out.write(static_cast<uint64_t>(data.wordsPerIndividual));
+        out.writeVector(data.packedChromosomes);
+        out.writeVector(data.fitness);
+        out.writeVector(data.fitnessPercentage);
+        out.writeVector(data.fitnessValid);
+        out.writeVector(data.selfAdaptiveRates);
+        out.write(data.evaluationCount);
+        out.write(data.elapsedSeconds);
+        out.write(static_cast<uint8_t>(data.hasBestSoFar));
+        out.write(static_cast<int32_t>(data.bestSoFarLength));
+        out.writeVector(data.bestSoFarChromosome);
+        out.write(data.bestSoFarFitness);
+        out.writeVector(data.criterionState);
+        out.write(data.initialMutationRate);
+        out.write(data.initialCrossoverRate);
+        out.write(data.initialMinValue);
+        out.write(data.initialMaxValue);
+        out.write(static_cast<int32_t>(data.initialChromosomeLength));
+        out.write(static_cast<int32_t>(data.refinementCount));
+
+        out.write(static_cast<uint64_t>(data.statistics.size()));
+        for (const GenerationStats& stats : data.statistics) {
+            writeStats(out, stats);
+        }
+
+        // Write to a temporary file first so a crash never leaves a torn checkpoint
+        std::string tempPath = path + ".tmp";
+        FILE* file = std::fopen(tempPath.c_str(), "wb");
+        if (!file) {
+            throw std::runtime_error("Cannot open checkpoint file for writing: " + tempPath);
+        }
+
+        size_t written = std::fwrite(buffer.data(), 1, buffer.size(), file);
+        bool closed = (std::fclose(file) == 0);
+        if (written != buffer.size() || !closed) {
+            std::remove(tempPath.c_str());
+            throw std::runtime_error("Failed to write checkpoint file: " + tempPath);
+        }
+
+        #ifdef _WIN32
+        std::remove(path.c_str());  // rename() does not overwrite on Windows
+        #endif
+        if (std::rename(tempPath.c_str(), path.c_str()) != 0) {
+            throw std::runtime_error("Failed to move checkpoint into place: " + path);
+        }
+    }
+
+    // Read a snapshot back from disk
+    CheckpointData Checkpoint::load(const std::string& path) {
+        FILE* file = std::fopen(path.c_str(), "rb");
+        if (!file) {
+            throw std::runtime_error("Cannot open checkpoint file: " + path);
+        }
+
+        std::vector<char> buffer;
+        char chunk[65536];
+        size_t count;
+        while ((count = std::fread(chunk, 1, sizeof(chunk), file)) > 0) {
+            buffer.insert(buffer.end(), chunk, chunk + count);
+        }
+        std::fclose(file);
+
+        BinaryReader in(buffer);
+        if (in.read<uint32_t>() != MAGIC) {
+            throw std::runtime_error("Not a genetic algorithm checkpoint: " + path);
+        }
+        uint32_t version = in.read<uint32_t>();
+        if (version < 1 || version > VERSION) {
+            throw std::runtime_error("Unsupported checkpoint version: " + path);
+        }
+
+        CheckpointData data;
+        readConfig(in, data.config, version);
+        data.generation = in.read<int32_t>();
+        data.functionName = in.readString();
+        data.functionExpression = in.readString();
+        in.readVector(data.rngState);
+        data.chromosomeLength = in.read<int32_t>();
+        data.wordsPerIndividual = static_cast<size_t>(in.read<uint64_t>());
+        in.readVector(data.packedChromosomes);
+        in.readVector(data.fitness);
+        in.readVector(data.fitnessPercentage);
+        in.readVector(data.fitnessValid);
+        if (version >= 6) {
+            in.readVector(data.selfAdaptiveRates);
+        }
+        
+        // Versions before 8 did not carry the spent budget (resumed runs start it from zero)
+        if (version >= 8) {
+            data.evaluationCount = in.read<uint64_t>();
+            data.elapsedSeconds = in.read<double>();
+            data.hasBestSoFar = in.read<uint8_t>() != 0;
+            data.bestSoFarLength = in.read<int32_t>();
+            in.readVector(data.bestSoFarChromosome);
+            data.bestSoFarFitness = in.read<double>();
+        }
+        
+        // Versions before 9 did not carry stopping criterion state (it restarts on resume)
+        if (version >= 9) {
+            data.hasCriterionState = true;
+            in.readVector(data.criterionState);
+        }
+        
+        // Versions before 10 did not carry the rate control baseline (the checkpointed rates stand in)
+        if (version >= 10) {
+            data.initialMutationRate = in.read<double>();
+            data.initialCrossoverRate = in.read<double>();
+        } else {
+            data.initialMutationRate = data.config.mutationRate;
+            data.initialCrossoverRate = data.config.crossoverRate;
+        }
+        
+        // Versions before 11 did not carry the original domain (the checkpointed domain stands in)
+        if (version >= 11) {
+            data.initialMinValue = in.read<double>();
+            data.initialMaxValue = in.read<double>();
+            data.initialChromosomeLength = in.read<int32_t>();
+            data.refinementCount = in.read<int32_t>();
+        } else {
+            data.initialMinValue = data.config.minValue;
+            data.initialMaxValue = data.config.maxValue;
+            data.initialChromosomeLength = data.config.chromosomeLength;
+        }
+
+        uint64_t statsCount = in.read<uint64_t>();
+        data.statistics.reserve(static_cast<size_t>(statsCount));
+        for (uint64_t i = 0; i < statsCount; ++i) {
+            data.statistics.push_back(readStats(in));
+        }
+
+        // Validate column sizes against each other
+        size_t individuals = data.fitness.size();
+        if (data.fitnessPercentage.size() != individuals || data.fitnessValid.size() != individuals ||
+            data.packedChromosomes.size() != individuals * data.wordsPerIndividual ||
+            (!data.selfAdaptiveRates.empty() && data.selfAdaptiveRates.size() != individuals) ||
+            (data.hasBestSoFar && (data.bestSoFarLength <= 0 ||
+                                   data.bestSoFarChromosome.size() != (static_cast<size_t>(data.bestSoFarLength) + 63) / 64)) ||
+            data.wordsPerIndividual != (static_cast<size_t>(data.chromosomeLength) + 63) / 64) {
+            throw std::runtime_error("Checkpoint file is inconsistent: " + path);
+        }
+
+        return data;
+    }
+
+    // CheckpointWriter implementation
+    CheckpointWriter::CheckpointWriter(const std::string& path)
+        : path(path), front(new CheckpointData()), back(new CheckpointData()),
+          pending(false), stopping(false) {
+        worker = std::thread(&CheckpointWriter::writerLoop, this);
+    }
+
+    CheckpointWriter::~CheckpointWriter() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+        worker.join();
+    }
+
+    CheckpointData& CheckpointWriter::backBuffer() {
+        return *back;
+    }
+
+    void CheckpointWriter::submit() {
+        std::unique_lock<std::mutex> lock(mutex);
+        rethrowPendingError();
+
+        // Wait until the writer has finished with the previous snapshot
+        condition.wait(lock, [this] { return !pending; });
+        std::swap(front, back);
+        pending = true;
+        lock.unlock();
+        condition.notify_all();
+    }
+
+    void CheckpointWriter::flush() {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this] { return !pending; });
+        rethrowPendingError();
+    }
+
+    const std::string& CheckpointWriter::getPath() const {
+        return path;
+    }
+
+    void CheckpointWriter::writerLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            condition.wait(lock, [this] { return pending || stopping; });
+            if (!pending) {
+                return;  // Stopping with nothing left to write
+            }
+
+            // The front buffer is not touched by the engine while pending is set
+            lock.unlock();
+            std::exception_ptr error;
+            try {
+                Checkpoint::save(*front, path);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+
+            if (error && !writeError) {
+                writeError = error;
+            }
+            pending = false;
+            condition.notify_all();
+        }
+    }
+
+    void CheckpointWriter::rethrowPendingError() {
+        if (writeError) {
+            std::exception_ptr error = writeError;
+            writeError = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+}
@@ -0,0 +1,139 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include "GeneticTypes.h"
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+namespace GA {
+    /**
+     * @struct CheckpointData
+     * @brief Complete resumable state of a genetic algorithm run
+     *
+     * Chromosomes are stored packed (64 bits per word, wordsPerIndividual words
+     * per individual) so that large populations stay compact on disk.
+     */
+    struct CheckpointData {
+        GAConfig config;                           // Algorithm configuration of the run
+        int generation = 0;                        // Generation at which the snapshot was taken
+        std::string functionName;                  // Name of the fitness function
+        std::string functionExpression;            // Expression of the fitness function
+        std::vector<uint32_t> rngState;            // Serialized random number generator state
+        int chromosomeLength = 0;                  // Bits per chromosome
+        size_t wordsPerIndividual = 0;             // Packed 64-bit words per chromosome
+        std::vector<uint64_t> packedChromosomes;   // Packed chromosome bits for every individual
+        std::vector<FitnessValue> fitness;         // Raw fitness of every individual
+        std::vector<double> fitnessPercentage;     // Fitness percentage of every individual
+        std::vector<uint8_t> fitnessValid;         // Whether each fitness value has been calculated
+        std::vector<double> selfAdaptiveRates;     // Mutation rate carried by every individual (empty = none carried)
+        uint64_t evaluationCount = 0;              // Fitness evaluations spent so far (evaluation budget)
+        double elapsedSeconds = 0.0;               // Run time spent so far (time limit)
+        bool hasBestSoFar = false;                 // Whether the best individual seen so far is stored
+        int bestSoFarLength = 0;                   // Bits of the best-so-far chromosome
+        std::vector<uint64_t> bestSoFarChromosome; // Packed best-so-far chromosome
+        FitnessValue bestSoFarFitness = 0.0;       // Fitness of the best-so-far individual
+        bool hasCriterionState = false;            // Whether criterionState was saved (version 9 and later)
+        std::vector<double> criterionState;        // StoppingCriterion::saveState values
+        double initialMutationRate = 0.0;          // Rates the run started from (rate control baseline)
+        double initialCrossoverRate = 0.0;
+        double initialMinValue = 0.0;              // Domain the run started from (before adaptive refinement)
+        double initialMaxValue = 0.0;
+        int initialChromosomeLength = 0;           // Chromosome length the run started from
+        int refinementCount = 0;                   // Domain refinements so far
+        std::vector<GenerationStats> statistics;   // Statistics history of the run
+
+        /**
+         * @brief Gets the number of individuals stored in the snapshot
+         * @return Population size
+         */
+        size_t populationSize() const { return fitness.size(); }
+    };
+
+    /**
+     * @class Checkpoint
+     * @brief Reads and writes the compact binary checkpoint format
+     *
+     * Layout: magic "GACP", format version, configuration, generation, function
+     * identity, RNG state, packed population columns and statistics history.
+     */
+    class Checkpoint {
+    public:
+        static constexpr uint32_t MAGIC = 0x50434147;  // "GACP" in little-endian order
+        static constexpr uint32_t VERSION = 11;        // Versions 1-10 (fewer fields) still load
+
+        /**
+         * @brief Writes a checkpoint atomically (temporary file followed by rename)
+         * @param data Snapshot to write
+         * @param path Destination file path
+         */
+        static void save(const CheckpointData& data, const std::string& path);
+
+        /**
+         * @brief Reads a checkpoint file
+         * @param path Source file path
+         * @return The restored snapshot
+         */
+        static CheckpointData load(const std::string& path);
+    };
+
+    /**
+     * @class CheckpointWriter
+     * @brief Double-buffered background checkpoint writer
+     *
+     * The engine fills the back buffer while the writer thread persists the
+     * front buffer. submit() only blocks if the previous snapshot is still
+     * being written, so checkpointing overlaps with evolution.
+     */
+    class CheckpointWriter {
+    private:
+        std::string path;                          // Destination file path
+        std::unique_ptr<CheckpointData> front;     // Snapshot owned by the writer thread
+        std::unique_ptr<CheckpointData> back;      // Snapshot being filled by the engine
+        bool pending;                              // True while front holds an unwritten snapshot
+        bool stopping;                             // Set when the writer thread must exit
+        std::exception_ptr writeError;             // First error raised by the writer thread
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::thread worker;
+
+        void writerLoop();
+        void rethrowPendingError();
+
+    public:
+        explicit CheckpointWriter(const std::string& path);
+        ~CheckpointWriter();
+
+        CheckpointWriter(const CheckpointWriter&) = delete;
+        CheckpointWriter& operator=(const CheckpointWriter&) = delete;
+
+        /**
+         * @brief Gets the back buffer to be filled with the next snapshot
+         * @return Reference to the back buffer (reused between snapshots)
+         */
+        CheckpointData& backBuffer();
+
+        /**
+         * @brief Hands the back buffer to the writer thread
+         */
+        void submit();
+
+        /**
+         * @brief Blocks until every submitted snapshot has been written
+         */
+        void flush();
+
+        /**
+         * @brief Gets the destination path
+         * @return The checkpoint file path
+         */
+        const std::string& getPath() const;
+    };
+}
+
+#endif // CHECKPOINT_H
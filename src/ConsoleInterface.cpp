@@ -375,7 +375,7 @@ namespace GA {
         displaySeparator(20, '-');
         resetColor();
         
-        std::cout << "  Total Generations:    " << stats.size() - 1 << std::endl;
+        std::cout << "  Total Generations:    " << stats.back().generation << std::endl;
         std::cout << "  Initial Best Fitness: " << formatNumber(stats[0].bestFitness, 6) 
                   << " (" << formatNumber(stats[0].bestFitnessPercentage, 1) << "%)" << std::endl;
         std::cout << "  Final Best Fitness:   " << formatNumber(stats.back().bestFitness, 6) 
@@ -422,6 +422,114 @@ namespace GA {
         std::cout << std::endl;
     }
     
+    // Display run accounting
+    void ConsoleInterface::displayRunSummary(const RunSummary& summary) {
+        setColor(Color::INFO);
+        std::cout << "RUN SUMMARY:" << std::endl;
+        displaySeparator(20, '-');
+        resetColor();
+        
+        std::cout << "  Generations:          " << summary.generations << std::endl;
+        std::cout << "  Fitness Evaluations:  " << summary.evaluations << std::endl;
+        std::cout << "  Wall Time:            " << formatNumber(summary.wallSeconds, 3) << " s" << std::endl;
+        std::cout << "  Evaluations/Second:   " << formatNumber(summary.evaluationsPerSecond, 0) << std::endl;
+        std::cout << "  Termination:          ";
+        setColor(summary.budgetExhausted ? Color::WARNING : Color::SUCCESS);
+        std::cout << summary.terminationReason;
+        resetColor();
+        std::cout << std::endl;
+        if (summary.polished.available) {
+            std::cout << "  Newton-Polished x:    " << formatNumber(summary.polished.value, 15)
+                      << " (f = " << formatNumber(summary.polished.fitness, 15) << ", "
+                      << summary.polished.iterations << " iterations)" << std::endl;
+        }
+        std::cout << std::endl;
+    }
+    
+    // Display per-phase profile
+    void ConsoleInterface::displayProfile(const GAProfile& profile) {
+        double totalNanoseconds = profile.getTotalNanoseconds();
+        if (totalNanoseconds <= 0.0) {
+            return;  // Built with GA_DISABLE_PROFILING or nothing ran
+        }
+        
+        setColor(Color::INFO);
+        std::cout << "PERFORMANCE PROFILE:" << std::endl;
+        displaySeparator(78, '-');
+        resetColor();
+        
+        std::vector<std::string> headers = {"Phase", "Calls", "Total ms", "Share", "Avg us", "p50 us", "p99 us"};
+        std::vector<int> widths = {20, 10, 10, 8, 10, 10, 10};
+        displayTableHeader(headers, widths);
+        
+        for (int i = 0; i < static_cast<int>(ProfilePhase::COUNT); ++i) {
+            ProfilePhase phase = static_cast<ProfilePhase>(i);
+            const PhaseProfile& entry = profile.getPhase(phase);
+            if (entry.calls == 0) {
+                continue;
+            }
+            
+            std::vector<std::string> data = {
+                profilePhaseName(phase),
+                std::to_string(entry.calls),
+                formatNumber(entry.totalNanoseconds / 1e6, 2),
+                formatNumber(entry.totalNanoseconds / totalNanoseconds * 100.0, 1) + "%",
+                formatNumber(entry.totalNanoseconds / entry.calls / 1e3, 2),
+                formatNumber(entry.percentileNanoseconds(0.50) / 1e3, 2),
+                formatNumber(entry.percentileNanoseconds(0.99) / 1e3, 2)
+            };
+            displayTableRow(data, widths);
+        }
+        std::cout << std::endl;
+        
+        for (int i = 0; i < static_cast<int>(ProfileCounter::COUNT); ++i) {
+            ProfileCounter counter = static_cast<ProfileCounter>(i);
+            std::string label = std::string(profileCounterName(counter)) + ":";
+            std::cout << "  " << std::left << std::setw(14) << label << std::right
+                      << profile.getCounter(counter) << std::endl;
+        }
+        std::cout << std::endl;
+        
+        // Hardware counters, normalized per individual that passed through evaluation
+        if (profile.hasHardwareCounters()) {
+            uint64_t individuals = profile.getCounter(ProfileCounter::EVALUATIONS) +
+                                   profile.getCounter(ProfileCounter::CACHE_HITS);
+            double perIndividual = (individuals > 0) ? 1.0 / individuals : 0.0;
+            
+            setColor(Color::INFO);
+            std::cout << "HARDWARE COUNTERS (per individual):" << std::endl;
+            displaySeparator(78, '-');
+            resetColor();
+            
+            std::vector<std::string> hardwareHeaders = {"Phase", "IPC", "Cycles", "Cache miss", "Branch miss", "dTLB miss"};
+            std::vector<int> hardwareWidths = {20, 8, 12, 12, 12, 12};
+            displayTableHeader(hardwareHeaders, hardwareWidths);
+            
+            for (int i = 0; i < static_cast<int>(ProfilePhase::COUNT); ++i) {
+                ProfilePhase phase = static_cast<ProfilePhase>(i);
+                const PhaseProfile& entry = profile.getPhase(phase);
+                if (entry.calls == 0) {
+                    continue;
+                }
+                
+                const HardwareCounterValues& hardware = entry.hardware;
+                std::vector<std::string> data = {
+                    profilePhaseName(phase),
+                    formatNumber(hardware.instructionsPerCycle(), 2),
+                    formatNumber(hardware.get(HardwareEvent::CYCLES) * perIndividual, 1),
+                    formatNumber(hardware.get(HardwareEvent::CACHE_MISSES) * perIndividual, 3),
+                    formatNumber(hardware.get(HardwareEvent::BRANCH_MISSES) * perIndividual, 3),
+                    formatNumber(hardware.get(HardwareEvent::DTLB_MISSES) * perIndividual, 3)
+                };
+                displayTableRow(data, hardwareWidths);
+            }
+            std::cout << std::endl;
+        } else if (!profile.getHardwareUnavailableReason().empty()) {
+            std::cout << "  Hardware counters unavailable: " << profile.getHardwareUnavailableReason() << std::endl;
+            std::cout << std::endl;
+        }
+    }
+    
     // Display main menu
     int ConsoleInterface::displayMenu() {
         clearScreen();
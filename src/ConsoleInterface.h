@@ -166,6 +166,18 @@ namespace GA {
                                const Individual& bestIndividual,
                                const GAConfig& config, const FitnessFunction& fitnessFunc);
         
+        /**
+         * @brief Displays the compute accounting of a run
+         * @param summary Summary returned by GeneticAlgorithm::getRunSummary
+         */
+        void displayRunSummary(const RunSummary& summary);
+        
+        /**
+         * @brief Displays where the run spent its time, phase by phase
+         * @param profile Profile returned by GeneticAlgorithm::getProfile
+         */
+        void displayProfile(const GAProfile& profile);
+        
         // User interaction methods
         /**
          * @brief Displays main menu and gets user choice
@@ -0,0 +1,84 @@
+#ifndef DUAL_H
+#define DUAL_H
+
+#include <cmath>
+
+namespace GA {
+    /**
+     * @struct Dual
+     * @brief Second-order forward-mode automatic differentiation number
+     *
+     * Carries a value and its first and second derivatives with respect to one
+     * variable through arithmetic and the elementary functions the built-in
+     * fitness functions use. Dual::variable(x) seeds the differentiation.
+     */
+    struct Dual {
+        double value;                   // f(x)
+        double first;                   // f'(x)
+        double second;                  // f''(x)
+        
+        Dual(double value = 0.0, double first = 0.0, double second = 0.0)
+            : value(value), first(first), second(second) {
+        }
+        
+        // The independent variable at x (derivative 1)
+        static Dual variable(double x) {
+            return Dual(x, 1.0, 0.0);
+        }
+    };
+    
+    inline Dual operator-(const Dual& a) {
+        return Dual(-a.value, -a.first, -a.second);
+    }
+    
+    inline Dual operator+(const Dual& a, const Dual& b) {
+        return Dual(a.value + b.value, a.first + b.first, a.second + b.second);
+    }
+    
+    inline Dual operator-(const Dual& a, const Dual& b) {
+        return Dual(a.value - b.value, a.first - b.first, a.second - b.second);
+    }
+    
+    inline Dual operator*(const Dual& a, const Dual& b) {
+        return Dual(a.value * b.value,
+                    a.first * b.value + a.value * b.first,
+                    a.second * b.value + 2.0 * a.first * b.first + a.value * b.second);
+    }
+    
+    inline Dual operator/(const Dual& a, const Dual& b) {
+        double quotient = a.value / b.value;
+        double first = (a.first - quotient * b.first) / b.value;
+        double second = (a.second - 2.0 * first * b.first - quotient * b.second) / b.value;
+        return Dual(quotient, first, second);
+    }
+    
+    // Mixed operations with constants
+    inline Dual operator+(const Dual& a, double b) { return Dual(a.value + b, a.first, a.second); }
+    inline Dual operator+(double a, const Dual& b) { return Dual(a + b.value, b.first, b.second); }
+    inline Dual operator-(const Dual& a, double b) { return Dual(a.value - b, a.first, a.second); }
+    inline Dual operator-(double a, const Dual& b) { return Dual(a - b.value, -b.first, -b.second); }
+    inline Dual operator*(const Dual& a, double b) { return Dual(a.value * b, a.first * b, a.second * b); }
+    inline Dual operator*(double a, const Dual& b) { return Dual(a * b.value, a * b.first, a * b.second); }
+    inline Dual operator/(const Dual& a, double b) { return Dual(a.value / b, a.first / b, a.second / b); }
+    inline Dual operator/(double a, const Dual& b) { return Dual(a) / b; }
+    
+    // Elementary functions (chain rule to second order)
+    inline Dual sin(const Dual& a) {
+        double s = std::sin(a.value);
+        double c = std::cos(a.value);
+        return Dual(s, c * a.first, c * a.second - s * a.first * a.first);
+    }
+    
+    inline Dual cos(const Dual& a) {
+        double s = std::sin(a.value);
+        double c = std::cos(a.value);
+        return Dual(c, -s * a.first, -s * a.second - c * a.first * a.first);
+    }
+    
+    inline Dual exp(const Dual& a) {
+        double e = std::exp(a.value);
+        return Dual(e, e * a.first, e * (a.second + a.first * a.first));
+    }
+}
+
+#endif // DUAL_H
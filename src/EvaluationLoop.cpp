@@ -0,0 +1,150 @@
+#include "EvaluationLoop.h"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <stdexcept>
+
+#ifdef GA_EVALUATION_LOOP_HAS_POLL
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <unistd.h>
+#endif
+
+namespace GA {
+
+    // Constructor
+    EvaluationLoop::EvaluationLoop() : timerSequence(0) {
+        #ifdef GA_EVALUATION_LOOP_HAS_POLL
+        if (pipe(wakeupPipe) != 0) {
+            throw std::runtime_error("Cannot create evaluation loop wakeup pipe");
+        }
+        for (int fd : wakeupPipe) {
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+            fcntl(fd, F_SETFD, FD_CLOEXEC);
+        }
+        #endif
+    }
+
+    // Destructor
+    EvaluationLoop::~EvaluationLoop() {
+        #ifdef GA_EVALUATION_LOOP_HAS_POLL
+        close(wakeupPipe[0]);
+        close(wakeupPipe[1]);
+        #endif
+    }
+
+    void EvaluationLoop::post(Callback callback) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            posted.push_back(std::move(callback));
+        }
+        #ifdef GA_EVALUATION_LOOP_HAS_POLL
+        char byte = 1;
+        ssize_t ignored = write(wakeupPipe[1], &byte, 1);  // A full pipe already wakes the loop
+        (void)ignored;
+        #else
+        wakeup.notify_one();
+        #endif
+    }
+
+    void EvaluationLoop::postAfter(Clock::duration delay, Callback callback) {
+        timers.push(Timer{Clock::now() + delay, timerSequence++, std::move(callback)});
+    }
+
+    bool EvaluationLoop::postWhenReadable(int fd, Callback callback) {
+        #ifdef GA_EVALUATION_LOOP_HAS_POLL
+        readWatchers.emplace_back(fd, std::move(callback));
+        return true;
+        #else
+        (void)fd;
+        (void)callback;
+        return false;
+        #endif
+    }
+
+    // Move callbacks posted by other threads onto the ready queue
+    void EvaluationLoop::takePosted() {
+        std::vector<Callback> taken;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            taken.swap(posted);
+        }
+        for (Callback& callback : taken) {
+            ready.push_back(std::move(callback));
+        }
+    }
+
+    // Block until a descriptor is readable, a callback is posted or the deadline passes
+    void EvaluationLoop::wait(const Clock::time_point* until) {
+        #ifdef GA_EVALUATION_LOOP_HAS_POLL
+        int timeout = -1;
+        if (until) {
+            long long remaining = std::chrono::duration_cast<std::chrono::milliseconds>(*until - Clock::now()).count();
+            timeout = static_cast<int>(std::min<long long>(std::max<long long>(remaining + 1, 0), INT_MAX));
+        }
+
+        std::vector<pollfd> polls;
+        polls.push_back({wakeupPipe[0], POLLIN, 0});
+        for (const std::pair<int, Callback>& watcher : readWatchers) {
+            polls.push_back({watcher.first, POLLIN, 0});
+        }
+        if (poll(polls.data(), polls.size(), timeout) < 0) {
+            if (errno == EINTR) {
+                return;
+            }
+            throw std::runtime_error("Evaluation loop poll failed");
+        }
+
+        char drain[64];
+        while (read(wakeupPipe[0], drain, sizeof(drain)) > 0) {
+        }
+
+        // Watchers are one-shot: a readable descriptor moves its callback to the ready queue
+        std::vector<std::pair<int, Callback>> waiting;
+        for (size_t i = 0; i < readWatchers.size(); ++i) {
+            if (polls[i + 1].revents != 0) {
+                ready.push_back(std::move(readWatchers[i].second));
+            } else {
+                waiting.push_back(std::move(readWatchers[i]));
+            }
+        }
+        readWatchers.swap(waiting);
+        #else
+        std::unique_lock<std::mutex> lock(mutex);
+        if (until) {
+            wakeup.wait_until(lock, *until, [&] { return !posted.empty(); });
+        } else {
+            wakeup.wait(lock, [&] { return !posted.empty(); });
+        }
+        #endif
+    }
+
+    void EvaluationLoop::runUntil(const std::function<bool()>& done) {
+        while (true) {
+            takePosted();
+            Clock::time_point now = Clock::now();
+            while (!timers.empty() && timers.top().due <= now) {
+                ready.push_back(timers.top().callback);
+                timers.pop();
+            }
+
+            // Callbacks may queue more callbacks; run until the queue is empty
+            while (!ready.empty()) {
+                Callback callback = std::move(ready.front());
+                ready.pop_front();
+                callback();
+            }
+
+            if (done()) {
+                return;
+            }
+
+            if (timers.empty()) {
+                wait(nullptr);
+            } else {
+                Clock::time_point due = timers.top().due;
+                wait(&due);
+            }
+        }
+    }
+}
@@ -0,0 +1,99 @@
+#ifndef EVALUATION_LOOP_H
+#define EVALUATION_LOOP_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define GA_EVALUATION_LOOP_HAS_POLL 1
+#endif
+
+namespace GA {
+    /**
+     * @class EvaluationLoop
+     * @brief Small single-threaded event loop for latency-bound fitness evaluations
+     *
+     * Callbacks run on the thread that calls runUntil. Asynchronous evaluations
+     * park on timers or file descriptors (POSIX) instead of blocking, so
+     * hundreds of them can wait at the same time. Other threads hand
+     * results back with post().
+     */
+    class EvaluationLoop {
+    public:
+        using Callback = std::function<void()>;
+        using Clock = std::chrono::steady_clock;
+
+    private:
+        struct Timer {
+            Clock::time_point due;                 // When the callback becomes ready
+            uint64_t sequence;                     // Keeps timers with equal due times in FIFO order
+            Callback callback;
+        };
+
+        struct TimerLater {
+            bool operator()(const Timer& a, const Timer& b) const {
+                return a.due != b.due ? a.due > b.due : a.sequence > b.sequence;
+            }
+        };
+
+        std::mutex mutex;                          // Guards posted
+        std::condition_variable wakeup;            // Signals posted callbacks (no poll support)
+        std::vector<Callback> posted;              // Callbacks handed over by any thread
+        std::deque<Callback> ready;                // Callbacks to run on the loop thread
+        std::priority_queue<Timer, std::vector<Timer>, TimerLater> timers;
+        uint64_t timerSequence;                    // Next timer sequence number
+        #ifdef GA_EVALUATION_LOOP_HAS_POLL
+        std::vector<std::pair<int, Callback>> readWatchers;  // Callbacks waiting for readable descriptors
+        int wakeupPipe[2];                         // Wakes poll() when another thread posts
+        #endif
+
+        void takePosted();
+        void wait(const Clock::time_point* until);
+
+    public:
+        EvaluationLoop();
+        ~EvaluationLoop();
+
+        EvaluationLoop(const EvaluationLoop&) = delete;
+        EvaluationLoop& operator=(const EvaluationLoop&) = delete;
+
+        /**
+         * @brief Queues a callback for the loop thread (safe to call from any thread)
+         * @param callback Function to run
+         */
+        void post(Callback callback);
+
+        /**
+         * @brief Runs a callback after a delay (loop thread only)
+         * @param delay Time to wait
+         * @param callback Function to run
+         */
+        void postAfter(Clock::duration delay, Callback callback);
+
+        /**
+         * @brief Runs a callback once a descriptor becomes readable (loop thread only)
+         * @param fd File descriptor to watch
+         * @param callback Function to run
+         * @return False if descriptor watching is not supported on this platform
+         */
+        bool postWhenReadable(int fd, Callback callback);
+
+        /**
+         * @brief Runs callbacks until a condition holds
+         * @param done Checked after every round of callbacks
+         *
+         * Waits for timers, descriptors and posted callbacks in between, so the
+         * condition must eventually be made true by one of them.
+         */
+        void runUntil(const std::function<bool()>& done);
+    };
+}
+
+#endif // EVALUATION_LOOP_H
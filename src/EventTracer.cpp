@@ -0,0 +1,164 @@
+#include "EventTracer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+
+namespace GA {
+
+    namespace {
+        uint64_t steadyNanoseconds() {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        // Session ids are unique across all tracers so thread caches never alias
+        std::atomic<uint64_t> nextSessionId(1);
+
+        // Buffers a thread recently recorded into, keyed by session id. The cache
+        // only saves the mutex: a miss looks the buffer up in the tracer itself,
+        // so any number of tracers can be active on one thread.
+        const size_t THREAD_CACHE_SIZE = 4;
+        struct ThreadCacheEntry {
+            uint64_t session = 0;
+            void* buffer = nullptr;
+        };
+
+        // Escape a string for a JSON literal
+        std::string escapeJson(const std::string& text) {
+            std::string escaped;
+            for (char c : text) {
+                if (c == '"' || c == '\\') {
+                    escaped += '\\';
+                    escaped += c;
+                } else if (static_cast<unsigned char>(c) < 0x20) {
+                    char code[8];
+                    std::snprintf(code, sizeof(code), "\\u%04x", c);
+                    escaped += code;
+                } else {
+                    escaped += c;
+                }
+            }
+            return escaped;
+        }
+    }
+
+    // Constructor
+    EventTracer::EventTracer(size_t eventLimit)
+        : enabled(false), sessionId(0), sessionStart(0), eventLimit(eventLimit) {
+    }
+
+    // Start a new session
+    void EventTracer::start() {
+        std::lock_guard<std::mutex> lock(mutex);
+        buffers.clear();
+        sessionStart = steadyNanoseconds();
+        sessionId.store(nextSessionId.fetch_add(1));
+        enabled.store(true);
+    }
+
+    void EventTracer::stop() {
+        enabled.store(false);
+    }
+
+    // Find (or register once per session) the calling thread's buffer
+    EventTracer::ThreadBuffer& EventTracer::threadBuffer() {
+        thread_local ThreadCacheEntry cache[THREAD_CACHE_SIZE];
+        thread_local size_t nextEntry = 0;
+
+        uint64_t session = sessionId.load(std::memory_order_acquire);
+        for (const ThreadCacheEntry& entry : cache) {
+            if (entry.session == session && entry.buffer) {
+                return *static_cast<ThreadBuffer*>(entry.buffer);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        std::thread::id self = std::this_thread::get_id();
+        ThreadBuffer* buffer = nullptr;
+        for (const std::unique_ptr<ThreadBuffer>& candidate : buffers) {
+            if (candidate->owner == self) {
+                buffer = candidate.get();
+                break;
+            }
+        }
+        if (!buffer) {
+            buffers.push_back(std::make_unique<ThreadBuffer>());
+            buffer = buffers.back().get();
+            buffer->owner = self;
+            buffer->events.reserve(std::min<size_t>(eventLimit, 4096));
+        }
+
+        cache[nextEntry] = {session, buffer};
+        nextEntry = (nextEntry + 1) % THREAD_CACHE_SIZE;
+        return *buffer;
+    }
+
+    // Append an event to the calling thread's buffer
+    void EventTracer::record(char phase, const char* name, const char* category, int64_t argument) {
+        ThreadBuffer& buffer = threadBuffer();
+        if (buffer.events.size() >= eventLimit) {
+            buffer.droppedEvents++;
+            return;
+        }
+        buffer.events.push_back({name, category, steadyNanoseconds() - sessionStart, argument, phase});
+    }
+
+    void EventTracer::setThreadName(const std::string& name) {
+        if (isEnabled()) {
+            threadBuffer().threadName = name;
+        }
+    }
+
+    size_t EventTracer::getEventCount() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t count = 0;
+        for (const std::unique_ptr<ThreadBuffer>& buffer : buffers) {
+            count += buffer->events.size();
+        }
+        return count;
+    }
+
+    // Dump every thread buffer as Chrome Trace Event JSON
+    void EventTracer::writeChromeTrace(const std::string& path) const {
+        FILE* file = std::fopen(path.c_str(), "w");
+        if (!file) {
+            throw std::runtime_error("Cannot open trace file for writing: " + path);
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        std::fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+        bool first = true;
+
+        for (size_t tid = 0; tid < buffers.size(); ++tid) {
+            const ThreadBuffer& buffer = *buffers[tid];
+            std::string threadName = buffer.threadName.empty() ? "Thread " + std::to_string(tid) : buffer.threadName;
+            std::fprintf(file, "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %zu, "
+                               "\"args\": {\"name\": \"%s\"}}",
+                         first ? "" : ",\n", tid, escapeJson(threadName).c_str());
+            first = false;
+
+            for (const TraceEvent& event : buffer.events) {
+                std::fprintf(file, ",\n{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"%c\", \"ts\": %.3f, \"pid\": 1, \"tid\": %zu",
+                             escapeJson(event.name).c_str(), escapeJson(event.category).c_str(), event.phase,
+                             event.timestampNanoseconds / 1000.0, tid);
+                if (event.argument >= 0) {
+                    std::fprintf(file, ", \"args\": {\"value\": %lld}", static_cast<long long>(event.argument));
+                }
+                std::fprintf(file, "}");
+            }
+
+            if (buffer.droppedEvents > 0) {
+                std::fprintf(file, ",\n{\"name\": \"dropped_events\", \"ph\": \"i\", \"s\": \"t\", \"ts\": 0, \"pid\": 1, "
+                                   "\"tid\": %zu, \"args\": {\"count\": %llu}}",
+                             tid, static_cast<unsigned long long>(buffer.droppedEvents));
+            }
+        }
+
+        std::fprintf(file, "\n]}\n");
+        bool failed = std::ferror(file) != 0;
+        if (std::fclose(file) != 0 || failed) {
+            throw std::runtime_error("Failed to write trace file: " + path);
+        }
+    }
+}
@@ -0,0 +1,154 @@
+#ifndef EVENT_TRACER_H
+#define EVENT_TRACER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+
+/**
+ * @file EventTracer.h
+ * @brief Timeline of begin/end events exported as Chrome Trace Event JSON
+ *
+ * Each thread appends to its own buffer without locking; the tracer's mutex
+ * is only taken the first time a thread records during a session. Load the
+ * written file in chrome://tracing or ui.perfetto.dev.
+ */
+
+namespace GA {
+    /**
+     * @struct TraceEvent
+     * @brief One begin ('B') or end ('E') event
+     */
+    struct TraceEvent {
+        const char* name;                          // Event name (string literal)
+        const char* category;                      // Event category (string literal)
+        uint64_t timestampNanoseconds;             // Time since the session started
+        int64_t argument;                          // Optional numeric argument (-1 = none)
+        char phase;                                // 'B' or 'E'
+    };
+
+    /**
+     * @class EventTracer
+     * @brief Collects per-thread event buffers for one tracing session
+     */
+    class EventTracer {
+    public:
+        static const size_t DEFAULT_EVENT_LIMIT = 1 << 20;  // Events kept per thread
+
+    private:
+        struct ThreadBuffer {
+            std::vector<TraceEvent> events;
+            std::string threadName;
+            std::thread::id owner;                 // Thread that records into this buffer
+            uint64_t droppedEvents = 0;
+        };
+
+        std::atomic<bool> enabled;                 // Whether events are being recorded
+        std::atomic<uint64_t> sessionId;           // Keys the per-thread buffer caches (unique across tracers)
+        uint64_t sessionStart;                     // steady_clock time of start() in ns
+        size_t eventLimit;                         // Per-thread event cap
+        mutable std::mutex mutex;                  // Guards the buffer list
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers;  // One buffer per recording thread
+
+        ThreadBuffer& threadBuffer();
+        void record(char phase, const char* name, const char* category, int64_t argument);
+
+    public:
+        /**
+         * @brief Creates a disabled tracer
+         * @param eventLimit Events kept per thread (later events are counted as dropped)
+         */
+        explicit EventTracer(size_t eventLimit = DEFAULT_EVENT_LIMIT);
+
+        EventTracer(const EventTracer&) = delete;
+        EventTracer& operator=(const EventTracer&) = delete;
+
+        /**
+         * @brief Clears previous events and starts recording
+         */
+        void start();
+
+        /**
+         * @brief Stops recording (events are kept until the next start)
+         */
+        void stop();
+
+        bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Records the start of a nested event on the calling thread
+         * @param name Event name (must outlive the tracer, e.g. a string literal)
+         * @param category Event category
+         * @param argument Optional numeric argument shown in the trace viewer
+         */
+        void begin(const char* name, const char* category, int64_t argument = -1) {
+            if (isEnabled()) {
+                record('B', name, category, argument);
+            }
+        }
+
+        /**
+         * @brief Records the end of the innermost open event on the calling thread
+         */
+        void end(const char* name, const char* category) {
+            if (isEnabled()) {
+                record('E', name, category, -1);
+            }
+        }
+
+        /**
+         * @brief Names the calling thread in the exported timeline
+         * @param name Thread name
+         */
+        void setThreadName(const std::string& name);
+
+        /**
+         * @brief Gets the number of recorded events across all threads
+         * @return Event count
+         */
+        size_t getEventCount() const;
+
+        /**
+         * @brief Writes all buffers as Chrome Trace Event JSON
+         * @param path Destination file path
+         *
+         * Must not run concurrently with recording threads (call after stop()).
+         */
+        void writeChromeTrace(const std::string& path) const;
+    };
+
+    /**
+     * @class ScopedTraceEvent
+     * @brief Records a begin event on construction and the matching end on destruction
+     */
+    class ScopedTraceEvent {
+    private:
+        EventTracer& tracer;
+        const char* name;
+        const char* category;
+        bool active;
+
+    public:
+        ScopedTraceEvent(EventTracer& tracer, const char* name, const char* category, int64_t argument = -1)
+            : tracer(tracer), name(name), category(category), active(tracer.isEnabled()) {
+            if (active) {
+                tracer.begin(name, category, argument);
+            }
+        }
+
+        ~ScopedTraceEvent() {
+            if (active) {
+                tracer.end(name, category);
+            }
+        }
+
+        ScopedTraceEvent(const ScopedTraceEvent&) = delete;
+        ScopedTraceEvent& operator=(const ScopedTraceEvent&) = delete;
+    };
+}
+
+#endif // EVENT_TRACER_H
@@ -1,16 +1,129 @@
 #include "FitnessFunction.h"
+#include "EvaluationLoop.h"
 #include <cmath>
 #include <stdexcept>
 #include <limits>
 #include <algorithm>
+#include <vector>
 
 namespace GA {
+    namespace {
+        const double PI = 3.14159265358979323846;
+        const double MAX_ANALYTIC_PIECES = 1e6;  // Larger domains use the generic search
+        
+        // Widen (minimum, maximum) to include a value
+        void includeValue(std::pair<double, double>& extrema, double value) {
+            extrema.first = std::min(extrema.first, value);
+            extrema.second = std::max(extrema.second, value);
+        }
+        
+        // Extrema over the two endpoints of the domain
+        std::pair<double, double> endpointExtrema(const FitnessFunction& function, double minValue, double maxValue) {
+            double low = function.evaluate(minValue);
+            double high = function.evaluate(maxValue);
+            return std::make_pair(std::min(low, high), std::max(low, high));
+        }
+        
+        // Evaluate the function at the real roots of qa·x² + qb·x + qc that lie in the domain
+        void includeQuadraticRoots(const FitnessFunction& function, double qa, double qb, double qc,
+                                   double minValue, double maxValue, std::pair<double, double>& extrema) {
+            double roots[2];
+            int rootCount = 0;
+            if (qa == 0.0) {
+                if (qb != 0.0) {
+                    roots[rootCount++] = -qc / qb;
+                }
+            } else {
+                double discriminant = qb * qb - 4.0 * qa * qc;
+                if (discriminant >= 0.0) {
+                    // Stable form: no cancellation between -qb and the square root
+                    double q = -0.5 * (qb + std::copysign(std::sqrt(discriminant), qb));
+                    roots[rootCount++] = q / qa;
+                    if (q != 0.0) {
+                        roots[rootCount++] = qc / q;
+                    }
+                }
+            }
+            for (int i = 0; i < rootCount; ++i) {
+                if (roots[i] >= minValue && roots[i] <= maxValue) {
+                    includeValue(extrema, function.evaluate(roots[i]));
+                }
+            }
+        }
+        
+        // Whether target + 2πk lies in [phaseLow, phaseHigh] for some integer k
+        bool phaseReached(double target, double phaseLow, double phaseHigh) {
+            double k = std::ceil((phaseLow - target) / (2.0 * PI));
+            return target + 2.0 * PI * k <= phaseHigh;
+        }
+        
+        // Extrema of amplitude·wave(frequency·x + phase) + offset, where wave is 1 at
+        // peakPhase + 2πk and -1 half a period later
+        std::pair<double, double> periodicExtrema(const FitnessFunction& function, double amplitude, double frequency,
+                                                  double phase, double offset, double peakPhase,
+                                                  double minValue, double maxValue) {
+            std::pair<double, double> extrema = endpointExtrema(function, minValue, maxValue);
+            double phaseLow = std::min(frequency * minValue, frequency * maxValue) + phase;
+            double phaseHigh = std::max(frequency * minValue, frequency * maxValue) + phase;
+            if (phaseReached(peakPhase, phaseLow, phaseHigh)) {
+                includeValue(extrema, offset + amplitude);
+            }
+            if (phaseReached(peakPhase + PI, phaseLow, phaseHigh)) {
+                includeValue(extrema, offset - amplitude);
+            }
+            return extrema;
+        }
+        
+        // Golden-section search for the best value inside [left, right]
+        double goldenSection(const FitnessFunction& function, double left, double right, bool findMaximum) {
+            const double ratio = 0.61803398874989484820;
+            const int iterations = 40;
+            auto better = [findMaximum](double a, double b) { return findMaximum ? a > b : a < b; };
+            
+            double x1 = right - ratio * (right - left);
+            double x2 = left + ratio * (right - left);
+            double f1 = function.evaluate(x1);
+            double f2 = function.evaluate(x2);
+            for (int i = 0; i < iterations; ++i) {
+                if (better(f1, f2)) {
+                    right = x2;
+                    x2 = x1;
+                    f2 = f1;
+                    x1 = right - ratio * (right - left);
+                    f1 = function.evaluate(x1);
+                } else {
+                    left = x1;
+                    x1 = x2;
+                    f1 = f2;
+                    x2 = left + ratio * (right - left);
+                    f2 = function.evaluate(x2);
+                }
+            }
+            return better(f1, f2) ? f1 : f2;
+        }
+    }
     
     // Base FitnessFunction implementation
     FitnessFunction::FitnessFunction(const std::string& name, const std::string& expression, bool maximize)
         : functionName(name), functionExpression(expression), isMaximization(maximize) {
     }
     
+    FitnessFunction::FitnessFunction(const FitnessFunction& other)
+        : functionName(other.functionName), functionExpression(other.functionExpression),
+          isMaximization(other.isMaximization) {
+    }
+    
+    FitnessFunction& FitnessFunction::operator=(const FitnessFunction& other) {
+        if (this != &other) {
+            functionName = other.functionName;
+            functionExpression = other.functionExpression;
+            isMaximization = other.isMaximization;
+            std::lock_guard<std::mutex> lock(extremaMutex);
+            extremaCache.clear();
+        }
+        return *this;
+    }
+    
     FitnessValue FitnessFunction::evaluateIndividual(const Individual& individual, double minValue, double maxValue) const {
         // Decode the individual's chromosome to a real value
         double x = individual.decodeToValue(minValue, maxValue);
@@ -19,6 +132,40 @@ namespace GA {
         return evaluate(x);
     }
     
+    void FitnessFunction::evaluateBatch(const double* x, FitnessValue* fitness, size_t count) const {
+        for (size_t i = 0; i < count; ++i) {
+            fitness[i] = evaluate(x[i]);
+        }
+    }
+    
+    size_t FitnessFunction::getPreferredBatchSize() const {
+        return 32;
+    }
+    
+    bool FitnessFunction::supportsDerivatives() const {
+        return false;
+    }
+    
+    Dual FitnessFunction::evaluateDual(const Dual&) const {
+        throw std::logic_error(functionName + " does not provide derivatives");
+    }
+    
+    bool FitnessFunction::supportsAsyncEvaluation() const {
+        return false;
+    }
+    
+    void FitnessFunction::evaluateAsync(double x, EvaluationLoop& loop, EvaluationCompletion done) const {
+        (void)loop;
+        FitnessValue fitness;
+        try {
+            fitness = evaluate(x);
+        } catch (...) {
+            done(0.0, std::current_exception());
+            return;
+        }
+        done(fitness, nullptr);
+    }
+    
     const std::string& FitnessFunction::getName() const {
         return functionName;
     }
@@ -40,66 +187,93 @@ namespace GA {
     }
     
     double FitnessFunction::calculateFitnessPercentage(double fitnessValue, double bestKnownValue, double worstKnownValue) const {
-        // If we have theoretical optimal values, use them
-        if (!std::isnan(getOptimalValue())) {
-            double optimalValue = getOptimalValue();
-            
-            if (isMaximization) {
-                // For maximization: 100% when we reach optimal, 0% when we're far from it
-                if (std::abs(optimalValue - fitnessValue) < 1e-10) return 100.0;
-                
-                // Use range from worst known to optimal
-                double range = optimalValue - worstKnownValue;
-                if (range > 1e-10) {
-                    double percentage = ((fitnessValue - worstKnownValue) / range) * 100.0;
-                    return std::max(0.0, std::min(100.0, percentage));
-                }
-            } else {
-                // For minimization: 100% when we reach optimal (minimum), 0% when we're far from it
-                if (std::abs(fitnessValue - optimalValue) < 1e-10) return 100.0;
-                
-                // Use range from worst known to optimal  
-                double range = worstKnownValue - optimalValue;
-                if (range > 1e-10) {
-                    double percentage = ((worstKnownValue - fitnessValue) / range) * 100.0;
-                    return std::max(0.0, std::min(100.0, percentage));
-                }
+        return getPercentageScale(bestKnownValue, worstKnownValue).apply(fitnessValue);
+    }
+    
+    PercentageScale FitnessFunction::getPercentageScale(double bestKnownValue, double worstKnownValue) const {
+        PercentageScale scale;
+        scale.optimalValue = getOptimalValue();
+        scale.worstValue = worstKnownValue;
+        scale.maximize = isMaximization;
+        
+        // If we have a theoretical optimal value, use the range from worst known to optimal
+        // (100% when we reach the optimum, 0% at the worst known value)
+        if (!std::isnan(scale.optimalValue)) {
+            scale.range = isMaximization ? scale.optimalValue - worstKnownValue : worstKnownValue - scale.optimalValue;
+            if (scale.range > 1e-10) {
+                return scale;
             }
         }
         
-        // Fallback: use empirical range from population
-        double range = std::abs(bestKnownValue - worstKnownValue);
-        if (range < 1e-10) return 50.0; // If all values are the same, assign 50%
+        // Fallback: use empirical range from population (all values the same = 50%)
+        scale.range = std::abs(bestKnownValue - worstKnownValue);
+        return scale;
+    }
+    
+    std::pair<double, double> FitnessFunction::getTheoreticalRange(double minValue, double maxValue) const {
+        std::pair<double, double> domain(minValue, maxValue);
+        std::pair<double, double> extrema;
+        bool cached = false;
+        {
+            std::lock_guard<std::mutex> lock(extremaMutex);
+            auto entry = extremaCache.find(domain);
+            if (entry != extremaCache.end()) {
+                extrema = entry->second;
+                cached = true;
+            }
+        }
+        
+        // Computed outside the lock (findExtrema may be slow); a concurrent caller at worst repeats it
+        if (!cached) {
+            extrema = findExtrema(std::min(minValue, maxValue), std::max(minValue, maxValue));
+            std::lock_guard<std::mutex> lock(extremaMutex);
+            extremaCache[domain] = extrema;
+        }
         
         if (isMaximization) {
-            double percentage = ((fitnessValue - worstKnownValue) / range) * 100.0;
-            return std::max(0.0, std::min(100.0, percentage));
+            return std::make_pair(extrema.second, extrema.first); // (best, worst)
         } else {
-            double percentage = ((worstKnownValue - fitnessValue) / range) * 100.0;
-            return std::max(0.0, std::min(100.0, percentage));
+            return std::make_pair(extrema.first, extrema.second); // (best, worst)
         }
     }
     
-    std::pair<double, double> FitnessFunction::getTheoreticalRange(double minValue, double maxValue) const {
-        // Sample the function over the domain to estimate range
-        const int samples = 1000;
+    std::pair<double, double> FitnessFunction::findExtrema(double minValue, double maxValue) const {
+        // Coarse scan of the domain
+        const int samples = 256;
+        const size_t refinedCandidates = 4;
         double step = (maxValue - minValue) / samples;
         
-        double minFitness = std::numeric_limits<double>::max();
-        double maxFitness = std::numeric_limits<double>::lowest();
-        
+        std::vector<double> values(samples + 1);
+        std::pair<double, double> extrema(std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest());
         for (int i = 0; i <= samples; ++i) {
-            double x = minValue + i * step;
-            double fitness = evaluate(x);
-            minFitness = std::min(minFitness, fitness);
-            maxFitness = std::max(maxFitness, fitness);
+            values[i] = evaluate(i == samples ? maxValue : minValue + i * step);
+            includeValue(extrema, values[i]);
+        }
+        if (step <= 0.0) {
+            return extrema;
         }
         
-        if (isMaximization) {
-            return std::make_pair(maxFitness, minFitness); // (best, worst)
-        } else {
-            return std::make_pair(minFitness, maxFitness); // (best, worst)
+        // Refine around the most promising local minima and maxima of the scan
+        for (bool findMaximum : {false, true}) {
+            std::vector<int> candidates;
+            for (int i = 1; i < samples; ++i) {
+                bool extremum = findMaximum ? values[i] >= values[i - 1] && values[i] >= values[i + 1]
+                                            : values[i] <= values[i - 1] && values[i] <= values[i + 1];
+                if (extremum) {
+                    candidates.push_back(i);
+                }
+            }
+            std::sort(candidates.begin(), candidates.end(), [&](int left, int right) {
+                return findMaximum ? values[left] > values[right] : values[left] < values[right];
+            });
+            if (candidates.size() > refinedCandidates) {
+                candidates.resize(refinedCandidates);
+            }
+            for (int i : candidates) {
+                includeValue(extrema, goldenSection(*this, minValue + (i - 1) * step, minValue + (i + 1) * step, findMaximum));
+            }
         }
+        return extrema;
     }
     
     // QuadraticFunction implementation (for demonstration only)
@@ -114,10 +288,23 @@ namespace GA {
         // for the main assignment as it's specifically excluded (f(x) = x²)
     }
     
-    double QuadraticFunction::evaluate(double x) const {
+    template <typename T>
+    T QuadraticFunction::evaluateAt(const T& x) const {
         return a * x * x + b * x + c;
     }
     
+    double QuadraticFunction::evaluate(double x) const {
+        return evaluateAt(x);
+    }
+    
+    bool QuadraticFunction::supportsDerivatives() const {
+        return true;
+    }
+    
+    Dual QuadraticFunction::evaluateDual(const Dual& x) const {
+        return evaluateAt(x);
+    }
+    
     double QuadraticFunction::getOptimalX() const {
         if (std::abs(a) < 1e-10) {
             return std::numeric_limits<double>::quiet_NaN();  // Linear function, no single optimum
@@ -133,6 +320,13 @@ namespace GA {
         return evaluate(optimalX);
     }
     
+    std::pair<double, double> QuadraticFunction::findExtrema(double minValue, double maxValue) const {
+        // Endpoints and the vertex (root of f'(x) = 2ax + b)
+        std::pair<double, double> extrema = endpointExtrema(*this, minValue, maxValue);
+        includeQuadraticRoots(*this, 0.0, 2.0 * a, b, minValue, maxValue, extrema);
+        return extrema;
+    }
+    
     std::unique_ptr<FitnessFunction> QuadraticFunction::clone() const {
         return std::make_unique<QuadraticFunction>(a, b, c, isMaximization);
     }
@@ -147,8 +341,27 @@ namespace GA {
           A(amplitude), B(frequency), C(phase), D(offset) {
     }
     
+    template <typename T>
+    T SinusoidalFunction::evaluateAt(const T& x) const {
+        using std::sin;
+        return A * sin(B * x + C) + D;
+    }
+    
     double SinusoidalFunction::evaluate(double x) const {
-        return A * std::sin(B * x + C) + D;
+        return evaluateAt(x);
+    }
+    
+    bool SinusoidalFunction::supportsDerivatives() const {
+        return true;
+    }
+    
+    Dual SinusoidalFunction::evaluateDual(const Dual& x) const {
+        return evaluateAt(x);
+    }
+    
+    std::pair<double, double> SinusoidalFunction::findExtrema(double minValue, double maxValue) const {
+        // sin peaks at π/2 + 2πk and bottoms out at 3π/2 + 2πk
+        return periodicExtrema(*this, A, B, C, D, 0.5 * PI, minValue, maxValue);
     }
     
     std::unique_ptr<FitnessFunction> SinusoidalFunction::clone() const {
@@ -164,9 +377,22 @@ namespace GA {
           A(A_param) {
     }
     
+    template <typename T>
+    T RastriginFunction::evaluateAt(const T& x) const {
+        using std::cos;
+        return A + x * x - A * cos(2.0 * PI * x);
+    }
+    
     double RastriginFunction::evaluate(double x) const {
-        const double PI = 3.14159265358979323846;
-        return A + x * x - A * std::cos(2.0 * PI * x);
+        return evaluateAt(x);
+    }
+    
+    bool RastriginFunction::supportsDerivatives() const {
+        return true;
+    }
+    
+    Dual RastriginFunction::evaluateDual(const Dual& x) const {
+        return evaluateAt(x);
     }
     
     double RastriginFunction::getOptimalValue() const {
@@ -177,6 +403,55 @@ namespace GA {
         return 0.0;  // Global minimum is at x = 0
     }
     
+    std::pair<double, double> RastriginFunction::findExtrema(double minValue, double maxValue) const {
+        // f'(x) = 2x + 2πA·sin(2πx) is monotonic between the zeros of
+        // f''(x) = 2 + 4π²A·cos(2πx), so each such piece holds at most one critical point
+        std::vector<double> breaks{minValue, maxValue};
+        double cosine = -1.0 / (2.0 * PI * PI * A);
+        if (A != 0.0 && std::abs(cosine) <= 1.0) {
+            double offset = std::acos(cosine) / (2.0 * PI);
+            double first = std::floor(minValue) - 1.0;
+            double last = std::ceil(maxValue) + 1.0;
+            if ((last - first) * 2.0 > MAX_ANALYTIC_PIECES) {
+                return FitnessFunction::findExtrema(minValue, maxValue);
+            }
+            for (double k = first; k <= last; k += 1.0) {
+                for (double x : {k - offset, k + offset}) {
+                    if (x > minValue && x < maxValue) {
+                        breaks.push_back(x);
+                    }
+                }
+            }
+            std::sort(breaks.begin(), breaks.end());
+        }
+        
+        auto derivative = [this](double x) { return 2.0 * x + 2.0 * PI * A * std::sin(2.0 * PI * x); };
+        std::pair<double, double> extrema = endpointExtrema(*this, minValue, maxValue);
+        for (size_t i = 0; i + 1 < breaks.size(); ++i) {
+            double left = breaks[i];
+            double right = breaks[i + 1];
+            double leftSlope = derivative(left);
+            if ((leftSlope < 0.0) == (derivative(right) < 0.0)) {
+                continue;
+            }
+            // Bisect the sign change down to adjacent doubles
+            for (int iteration = 0; iteration < 200; ++iteration) {
+                double middle = 0.5 * (left + right);
+                if (middle <= left || middle >= right) {
+                    break;
+                }
+                if ((derivative(middle) < 0.0) == (leftSlope < 0.0)) {
+                    left = middle;
+                } else {
+                    right = middle;
+                }
+            }
+            includeValue(extrema, evaluate(left));
+            includeValue(extrema, evaluate(right));
+        }
+        return extrema;
+    }
+    
     std::unique_ptr<FitnessFunction> RastriginFunction::clone() const {
         return std::make_unique<RastriginFunction>(A, isMaximization);
     }
@@ -191,10 +466,30 @@ namespace GA {
           a(a_coeff), b(b_coeff), c(c_coeff), d(d_coeff) {
     }
     
-    double PolynomialFunction::evaluate(double x) const {
+    template <typename T>
+    T PolynomialFunction::evaluateAt(const T& x) const {
         return a * x * x * x + b * x * x + c * x + d;
     }
     
+    double PolynomialFunction::evaluate(double x) const {
+        return evaluateAt(x);
+    }
+    
+    bool PolynomialFunction::supportsDerivatives() const {
+        return true;
+    }
+    
+    Dual PolynomialFunction::evaluateDual(const Dual& x) const {
+        return evaluateAt(x);
+    }
+    
+    std::pair<double, double> PolynomialFunction::findExtrema(double minValue, double maxValue) const {
+        // Endpoints and the roots of f'(x) = 3ax² + 2bx + c
+        std::pair<double, double> extrema = endpointExtrema(*this, minValue, maxValue);
+        includeQuadraticRoots(*this, 3.0 * a, 2.0 * b, c, minValue, maxValue, extrema);
+        return extrema;
+    }
+    
     std::unique_ptr<FitnessFunction> PolynomialFunction::clone() const {
         return std::make_unique<PolynomialFunction>(a, b, c, d, isMaximization);
     }
@@ -208,8 +503,27 @@ namespace GA {
           A(A_param), B(B_param), C(C_param) {
     }
     
+    template <typename T>
+    T ExponentialFunction::evaluateAt(const T& x) const {
+        using std::exp;
+        return A * exp(B * x) + C;
+    }
+    
     double ExponentialFunction::evaluate(double x) const {
-        return A * std::exp(B * x) + C;
+        return evaluateAt(x);
+    }
+    
+    bool ExponentialFunction::supportsDerivatives() const {
+        return true;
+    }
+    
+    Dual ExponentialFunction::evaluateDual(const Dual& x) const {
+        return evaluateAt(x);
+    }
+    
+    std::pair<double, double> ExponentialFunction::findExtrema(double minValue, double maxValue) const {
+        // Monotonic: the extrema are at the endpoints
+        return endpointExtrema(*this, minValue, maxValue);
     }
     
     std::unique_ptr<FitnessFunction> ExponentialFunction::clone() const {
@@ -224,10 +538,28 @@ namespace GA {
           a(a_coeff), b(b_coeff) {
     }
     
-    double LinearFunction::evaluate(double x) const {
+    template <typename T>
+    T LinearFunction::evaluateAt(const T& x) const {
         return a * x + b;
     }
     
+    double LinearFunction::evaluate(double x) const {
+        return evaluateAt(x);
+    }
+    
+    bool LinearFunction::supportsDerivatives() const {
+        return true;
+    }
+    
+    Dual LinearFunction::evaluateDual(const Dual& x) const {
+        return evaluateAt(x);
+    }
+    
+    std::pair<double, double> LinearFunction::findExtrema(double minValue, double maxValue) const {
+        // Monotonic: the extrema are at the endpoints
+        return endpointExtrema(*this, minValue, maxValue);
+    }
+    
     std::unique_ptr<FitnessFunction> LinearFunction::clone() const {
         return std::make_unique<LinearFunction>(a, b, isMaximization);
     }
@@ -242,8 +574,27 @@ namespace GA {
           A(amplitude), B(frequency), C(phase), D(offset) {
     }
     
+    template <typename T>
+    T CosineFunction::evaluateAt(const T& x) const {
+        using std::cos;
+        return A * cos(B * x + C) + D;
+    }
+    
     double CosineFunction::evaluate(double x) const {
-        return A * std::cos(B * x + C) + D;
+        return evaluateAt(x);
+    }
+    
+    bool CosineFunction::supportsDerivatives() const {
+        return true;
+    }
+    
+    Dual CosineFunction::evaluateDual(const Dual& x) const {
+        return evaluateAt(x);
+    }
+    
+    std::pair<double, double> CosineFunction::findExtrema(double minValue, double maxValue) const {
+        // cos peaks at 2πk and bottoms out at π + 2πk
+        return periodicExtrema(*this, A, B, C, D, 0.0, minValue, maxValue);
     }
     
     std::unique_ptr<FitnessFunction> CosineFunction::clone() const {
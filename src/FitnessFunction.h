@@ -3,13 +3,41 @@
 
 #include "GeneticTypes.h"
 #include "Individual.h"
+#include "Dual.h"
 #include <functional>
 #include <string>
 #include <cmath>
 #include <memory>
 #include <utility>
+#include <exception>
+#include <algorithm>
+#include <map>
+#include <mutex>
 
 namespace GA {
+    class EvaluationLoop;
+    
+    /**
+     * @struct PercentageScale
+     * @brief Fitness-to-percentage mapping with the per-function optimum hoisted out
+     *
+     * Built once per population by FitnessFunction::getPercentageScale, then
+     * applied to every individual without virtual calls.
+     */
+    struct PercentageScale {
+        double optimalValue;            // Fitness reported as exactly 100% (NaN = none)
+        double worstValue;              // Fitness mapped to 0%
+        double range;                   // Fitness distance from worstValue to 100% (< 1e-10 = everything is 50%)
+        bool maximize;                  // Whether fitness grows towards 100%
+        
+        double apply(double fitnessValue) const {
+            if (std::abs(optimalValue - fitnessValue) < 1e-10) return 100.0;
+            if (range < 1e-10) return 50.0;
+            double percentage = (maximize ? fitnessValue - worstValue : worstValue - fitnessValue) / range * 100.0;
+            return std::max(0.0, std::min(100.0, percentage));
+        }
+    };
+    
     /**
      * @class FitnessFunction
      * @brief Abstract base class for fitness function evaluation
@@ -24,10 +52,30 @@ namespace GA {
         std::string functionExpression; // Mathematical expression as string
         bool isMaximization;           // True for maximization, false for minimization
         
+        /**
+         * @brief Finds the smallest and largest function value over a domain
+         * @param minValue Domain minimum value
+         * @param maxValue Domain maximum value (>= minValue)
+         * @return Pair of (minimum, maximum) values
+         *
+         * The default scans the domain coarsely and refines the best local
+         * minima and maxima of the scan with golden-section search. The
+         * built-in functions override it with analytic extrema.
+         */
+        virtual std::pair<double, double> findExtrema(double minValue, double maxValue) const;
+        
+    private:
+        mutable std::mutex extremaMutex;        // Guards extremaCache
+        mutable std::map<std::pair<double, double>, std::pair<double, double>> extremaCache;  // (min, max) per domain
+        
     public:
         // Constructor
         FitnessFunction(const std::string& name, const std::string& expression, bool maximize = true);
         
+        // Copies the function definition (the extrema cache is not shared)
+        FitnessFunction(const FitnessFunction& other);
+        FitnessFunction& operator=(const FitnessFunction& other);
+        
         // Virtual destructor
         virtual ~FitnessFunction() = default;
         
@@ -44,6 +92,21 @@ namespace GA {
          */
         virtual double evaluate(double x) const = 0;
         
+        /**
+         * @brief Checks whether evaluateDual is implemented (default false)
+         * @return True if first and second derivatives are available
+         */
+        virtual bool supportsDerivatives() const;
+        
+        /**
+         * @brief Evaluates the function on a dual number (forward-mode differentiation)
+         * @param x The input, usually Dual::variable(x)
+         * @return f(x) with its first and second derivatives
+         *
+         * The default throws std::logic_error; check supportsDerivatives() first.
+         */
+        virtual Dual evaluateDual(const Dual& x) const;
+        
         /**
          * @brief Evaluates fitness for an individual
          * @param individual The individual to evaluate
@@ -53,6 +116,43 @@ namespace GA {
          */
         FitnessValue evaluateIndividual(const Individual& individual, double minValue, double maxValue) const;
         
+        /**
+         * @brief Evaluates fitness for a batch of decoded x values
+         * @param x Input values
+         * @param fitness Output fitness values (same length as x)
+         * @param count Number of values
+         *
+         * The default calls evaluate() for each value. Adapters with a per-call
+         * overhead (e.g. external worker processes) override it.
+         */
+        virtual void evaluateBatch(const double* x, FitnessValue* fitness, size_t count) const;
+        
+        /**
+         * @brief Gets how many individuals evaluatePopulation hands to evaluateBatch at once
+         * @return Preferred batch size (default 32)
+         */
+        virtual size_t getPreferredBatchSize() const;
+        
+        // Completion of an asynchronous evaluation: the fitness, or the error that prevented it
+        using EvaluationCompletion = std::function<void(FitnessValue fitness, std::exception_ptr error)>;
+        
+        /**
+         * @brief Checks whether evaluateAsync overlaps evaluations (default false)
+         * @return True if evaluatePopulation should launch all evaluations on an EvaluationLoop
+         */
+        virtual bool supportsAsyncEvaluation() const;
+        
+        /**
+         * @brief Starts evaluating x without blocking
+         * @param x The input value to the function
+         * @param loop Event loop the evaluation waits on (timers, descriptors, posted results)
+         * @param done Called exactly once, on the loop thread, with the result
+         *
+         * The default evaluates synchronously and completes immediately.
+         * Coroutine-based objectives derive from CoroutineFitnessFunction (AsyncFitness.h, C++20).
+         */
+        virtual void evaluateAsync(double x, EvaluationLoop& loop, EvaluationCompletion done) const;
+        
         /**
          * @brief Gets the function name
          * @return The function name
@@ -92,15 +192,30 @@ namespace GA {
          */
         virtual double calculateFitnessPercentage(double fitnessValue, double bestKnownValue, double worstKnownValue) const;
         
+        /**
+         * @brief Gets the mapping calculateFitnessPercentage applies for a given best and worst
+         * @param bestKnownValue The best fitness value found so far (for reference)
+         * @param worstKnownValue The worst fitness value found so far (for reference)
+         * @return Scale whose apply() matches calculateFitnessPercentage
+         *
+         * Functions overriding calculateFitnessPercentage must override this too.
+         */
+        virtual PercentageScale getPercentageScale(double bestKnownValue, double worstKnownValue) const;
+        
         /**
          * @brief Gets the theoretical best possible fitness percentage reference
          * @param minValue Domain minimum value
          * @param maxValue Domain maximum value 
          * @return A pair of (theoretical_best, theoretical_worst) values for percentage calculation
+         *
+         * Computed by findExtrema on the first call for a domain and memoized.
          */
         virtual std::pair<double, double> getTheoreticalRange(double minValue, double maxValue) const;
     };
     
+    // Built-in functions. Each writes its formula once as a private evaluateAt<T>
+    // template, instantiated by evaluate (T = double) and evaluateDual (T = Dual).
+    
     /**
      * @class QuadraticFunction
      * @brief Implementation of f(x) = ax^2 + bx + c (for demonstration purposes)
@@ -110,9 +225,17 @@ namespace GA {
     private:
         double a, b, c;  // Coefficients
         
+        template <typename T>
+        T evaluateAt(const T& x) const;
+        
+    protected:
+        std::pair<double, double> findExtrema(double minValue, double maxValue) const override;
+        
     public:
         QuadraticFunction(double a_coeff, double b_coeff, double c_coeff, bool maximize = false);
         double evaluate(double x) const override;
+        bool supportsDerivatives() const override;
+        Dual evaluateDual(const Dual& x) const override;
         double getOptimalX() const override;
         double getOptimalValue() const override;
         std::unique_ptr<FitnessFunction> clone() const override;
@@ -127,10 +250,18 @@ namespace GA {
     private:
         double A, B, C, D;  // Parameters
         
+        template <typename T>
+        T evaluateAt(const T& x) const;
+        
+    protected:
+        std::pair<double, double> findExtrema(double minValue, double maxValue) const override;
+        
     public:
         SinusoidalFunction(double amplitude = 1.0, double frequency = 1.0, 
                           double phase = 0.0, double offset = 0.0, bool maximize = true);
         double evaluate(double x) const override;
+        bool supportsDerivatives() const override;
+        Dual evaluateDual(const Dual& x) const override;
         std::unique_ptr<FitnessFunction> clone() const override;
     };
     
@@ -144,9 +275,17 @@ namespace GA {
     private:
         double A;  // Parameter (typically 10)
         
+        template <typename T>
+        T evaluateAt(const T& x) const;
+        
+    protected:
+        std::pair<double, double> findExtrema(double minValue, double maxValue) const override;
+        
     public:
         RastriginFunction(double A_param = 10.0, bool maximize = false);
         double evaluate(double x) const override;
+        bool supportsDerivatives() const override;
+        Dual evaluateDual(const Dual& x) const override;
         double getOptimalValue() const override;
         double getOptimalX() const override;
         std::unique_ptr<FitnessFunction> clone() const override;
@@ -161,9 +300,17 @@ namespace GA {
     private:
         double a, b, c, d;  // Coefficients
         
+        template <typename T>
+        T evaluateAt(const T& x) const;
+        
+    protected:
+        std::pair<double, double> findExtrema(double minValue, double maxValue) const override;
+        
     public:
         PolynomialFunction(double a_coeff, double b_coeff, double c_coeff, double d_coeff, bool maximize = true);
         double evaluate(double x) const override;
+        bool supportsDerivatives() const override;
+        Dual evaluateDual(const Dual& x) const override;
         std::unique_ptr<FitnessFunction> clone() const override;
     };
     
@@ -176,9 +323,17 @@ namespace GA {
     private:
         double A, B, C;  // Parameters
         
+        template <typename T>
+        T evaluateAt(const T& x) const;
+        
+    protected:
+        std::pair<double, double> findExtrema(double minValue, double maxValue) const override;
+        
     public:
         ExponentialFunction(double A_param = 1.0, double B_param = 0.1, double C_param = 0.0, bool maximize = true);
         double evaluate(double x) const override;
+        bool supportsDerivatives() const override;
+        Dual evaluateDual(const Dual& x) const override;
         std::unique_ptr<FitnessFunction> clone() const override;
     };
     
@@ -191,9 +346,17 @@ namespace GA {
     private:
         double a, b;  // Coefficients: slope and y-intercept
         
+        template <typename T>
+        T evaluateAt(const T& x) const;
+        
+    protected:
+        std::pair<double, double> findExtrema(double minValue, double maxValue) const override;
+        
     public:
         LinearFunction(double a_coeff = 1.0, double b_coeff = 0.0, bool maximize = true);
         double evaluate(double x) const override;
+        bool supportsDerivatives() const override;
+        Dual evaluateDual(const Dual& x) const override;
         std::unique_ptr<FitnessFunction> clone() const override;
     };
     
@@ -206,10 +369,18 @@ namespace GA {
     private:
         double A, B, C, D;  // Parameters: amplitude, frequency, phase, offset
         
+        template <typename T>
+        T evaluateAt(const T& x) const;
+        
+    protected:
+        std::pair<double, double> findExtrema(double minValue, double maxValue) const override;
+        
     public:
         CosineFunction(double amplitude = 1.0, double frequency = 1.0, 
                       double phase = 0.0, double offset = 0.0, bool maximize = true);
         double evaluate(double x) const override;
+        bool supportsDerivatives() const override;
+        Dual evaluateDual(const Dual& x) const override;
         std::unique_ptr<FitnessFunction> clone() const override;
     };
 }
@@ -1,22 +1,59 @@
 #include "GeneticAlgorithm.h"
+#include "PopulationSnapshot.h"
+#include "EvaluationLoop.h"
 #include <algorithm>
 #include <numeric>
 #include <random>
 #include <stdexcept>
 #include <cmath>
+#include <sstream>
+#include <atomic>
+#include <limits>
+
+// Time a phase into the profile and, while tracing, onto the timeline
+#define GA_PHASE_SCOPE(phase) \
+    GA_PROFILE_PHASE_COUNTERS(profile, phase, hardwareCounters.get()); \
+    ::GA::ScopedTraceEvent GA_PROFILE_CONCAT(traceEvent_, __LINE__)(tracer, profilePhaseName(phase), "phase")
 
 namespace GA {
     
+    // Smallest number of individuals handed to an evaluation worker
+    const size_t EVALUATION_CHUNK_MIN = 16;
+    
+    // Learning rate of self-adaptive mutation rates
+    const double SELF_ADAPTATION_LEARNING_RATE = 0.22;
+    
     // Constructor
     GeneticAlgorithm::GeneticAlgorithm(const GAConfig& config, std::unique_ptr<FitnessFunction> fitnessFunc)
-        : config(config), fitnessFunction(std::move(fitnessFunc)), currentGeneration(0) {
+        : config(config), fitnessFunction(std::move(fitnessFunc)),
+          statisticsSink(std::make_unique<InMemoryStatisticsSink>()), currentGeneration(0),
+          stoppingCriterion(std::make_unique<DiversityCriterion>(0.01)), evaluationCount(0),
+          budgetExhausted(false), hasBestSoFar(false), populationIndexValid(false),
+          populationSummaryValid(false), configuredMinValue(config.minValue), configuredMaxValue(config.maxValue),
+          configuredChromosomeLength(config.chromosomeLength), refinementCount(0),
+          rateController(createRateController(config)), configuredMutationRate(config.mutationRate),
+          configuredCrossoverRate(config.crossoverRate), offspringBred(0), offspringImproved(0) {
         
-        // Initialize random number generator with a random seed
-        std::random_device rd;
-        rng.seed(rd());
+        // Initialize random number generator (fixed seed for reproducible runs)
+        if (config.randomSeed != 0) {
+            rng.seed(config.randomSeed);
+        } else {
+            std::random_device rd;
+            rng.seed(rd());
+        }
         
         // Validate configuration
-        if (config.populationSize <= 0 || config.chromosomeLength <= 0 || config.maxGenerations <= 0) {
+        if (config.populationSize <= 0 || config.chromosomeLength <= 0 || config.maxGenerations <= 0 ||
+            config.evaluationThreads < 0 || config.timeLimitSeconds < 0.0 || config.steadyStateOffspring <= 0 ||
+            config.breedingChunkSize < 0 || config.refinementConcentration <= 0.0 ||
+            config.refinementConcentration > 1.0 || config.refinementShrink <= 0.0 || config.refinementShrink >= 1.0 ||
+            config.refinementBits < 0 || config.targetPrecision < 0.0 || config.localSearchInterval <= 0 ||
+            config.localSearchElites < 0 || config.localSearchEvaluations < 0 || config.finalMutationRate < 0.0 ||
+            config.finalMutationRate > 1.0 || config.finalCrossoverRate < 0.0 || config.finalCrossoverRate > 1.0 ||
+            config.targetDiversity < 0.0 || config.rateAdaptationFactor < 1.0 || config.minMutationRate <= 0.0 ||
+            config.maxMutationRate >= 1.0 || config.minMutationRate > config.maxMutationRate ||
+            config.nicheRadius <= 0.0 || config.sharingAlpha <= 0.0 || config.nicheCapacity < 1 ||
+            (config.niching != NichingType::NONE && config.evolutionMode != EvolutionMode::GENERATIONAL)) {
             throw std::invalid_argument("Invalid GA configuration parameters");
         }
         
@@ -27,231 +64,1033 @@ namespace GA {
     
     // Main algorithm execution
     GenerationStats GeneticAlgorithm::run() {
-        // Initialize the algorithm
-        initializePopulation();
-        evaluatePopulation();
-        
-        // Store initial statistics
-        statistics.clear();
-        statistics.push_back(calculateGenerationStats());
-        
-        // Evolution loop
-        for (currentGeneration = 1; currentGeneration <= config.maxGenerations; ++currentGeneration) {
-            GenerationStats stats = evolveGeneration();
-            statistics.push_back(stats);
-            
-            // Check for convergence
-            if (hasConverged()) {
-                break;
-            }
-        }
-        
-        return statistics.back();
+        return run(nullptr);
     }
     
     // Run with progress callback
     GenerationStats GeneticAlgorithm::run(ProgressCallback callback) {
         progressCallback = callback;
         
-        // Initialize the algorithm
-        initializePopulation();
-        evaluatePopulation();
+        // Initialize the algorithm (from the configured domain if a previous run refined it)
+        currentGeneration = 0;
+        config.minValue = configuredMinValue;
+        config.maxValue = configuredMaxValue;
+        config.chromosomeLength = configuredChromosomeLength;
+        config.mutationRate = configuredMutationRate;
+        config.crossoverRate = configuredCrossoverRate;
+        beginInstrumentation();
         
-        // Store initial statistics
-        statistics.clear();
-        GenerationStats initialStats = calculateGenerationStats();
-        statistics.push_back(initialStats);
+        GenerationStats initialStats;
+        stoppingCriterion->begin(config, *fitnessFunction);
+        {
+            ScopedTraceEvent initializationEvent(tracer, "Initialization", "generation", 0);
+            initializePopulation();
+            evaluatePopulation();
+            
+            // Store initial statistics
+            statisticsSink->begin(false);
+            initialStats = calculateGenerationStats();
+            statisticsSink->record(initialStats);
+        }
         
         // Call progress callback for initial generation
         if (progressCallback) {
             progressCallback(0, initialStats);
         }
         
-        // Evolution loop
-        for (currentGeneration = 1; currentGeneration <= config.maxGenerations; ++currentGeneration) {
+        return runEvolutionLoop();
+    }
+    
+    // Resume a run from a checkpoint file
+    GenerationStats GeneticAlgorithm::resume(const std::string& path, ProgressCallback callback) {
+        progressCallback = callback;
+        CheckpointData data = Checkpoint::load(path);
+        beginInstrumentation();
+        statisticsSink->begin(true);
+        restoreCheckpoint(data);
+        stoppingCriterion->begin(config, *fitnessFunction);
+        if (data.hasCriterionState) {
+            size_t position = 0;
+            stoppingCriterion->restoreState(data.criterionState, position);
+            if (position != data.criterionState.size()) {
+                throw std::runtime_error("Saved stopping criterion state does not match the criterion");
+            }
+        }
+        
+        // The checkpointed generation has already been reported; repeat the budget
+        // and stopping checks that followed it in the original run
+        if (checkComputeBudget() || checkStoppingCriterion(statisticsSink->last())) {
+            finishRun();
+            return statisticsSink->last();
+        }
+        
+        return runEvolutionLoop();
+    }
+    
+    // Prepare profiling, tracing and hardware counters for a run
+    void GeneticAlgorithm::beginInstrumentation() {
+        profile.reset();
+        evaluationCount = 0;
+        budgetExhausted = false;
+        hasBestSoFar = false;
+        refinementCount = 0;
+        terminationReason = "Maximum generations reached";
+        runStartTime = std::chrono::steady_clock::now();
+        
+        if (!config.traceOutputPath.empty()) {
+            tracer.start();
+            tracer.setThreadName("GA main");
+        }
+        
+        // Counters follow the calling thread, so they are reopened for every run
+        hardwareCounters.reset();
+        if (config.collectHardwareCounters) {
+            std::unique_ptr<HardwareCounters> counters = std::make_unique<HardwareCounters>();
+            if (counters->isAvailable()) {
+                hardwareCounters = std::move(counters);
+            } else {
+                profile.setHardwareUnavailableReason(counters->getUnavailableReason());
+            }
+        }
+    }
+    
+    // Check the evaluation budget and deadline
+    bool GeneticAlgorithm::checkComputeBudget() {
+        if (!budgetExhausted) {
+            if (config.maxEvaluations > 0 && evaluationCount >= config.maxEvaluations) {
+                budgetExhausted = true;
+                terminationReason = "Evaluation limit of " + std::to_string(config.maxEvaluations) + " reached";
+            } else if (config.timeLimitSeconds > 0.0 &&
+                       std::chrono::steady_clock::now() - runStartTime >= std::chrono::duration<double>(config.timeLimitSeconds)) {
+                budgetExhausted = true;
+                std::ostringstream reason;
+                reason << "Time limit of " << config.timeLimitSeconds << " s reached";
+                terminationReason = reason.str();
+            }
+        }
+        return budgetExhausted;
+    }
+    
+    // Flush outputs and account for the finished run
+    void GeneticAlgorithm::finishRun() {
+        // Evaluations still in flight are abandoned but were paid for
+        if (asyncEvaluator) {
+            evaluationCount += asyncEvaluator->cancel();
+        }
+        
+        // Make sure the last checkpoint and statistics are on disk before returning
+        if (checkpointWriter) {
+            checkpointWriter->flush();
+        }
+        statisticsSink->flush();
+        
+        // Export the timeline once every thread has finished recording
+        if (tracer.isEnabled()) {
+            tracer.stop();
+            tracer.writeChromeTrace(config.traceOutputPath);
+        }
+        
+        // Take the best solution below the chromosome resolution
+        runSummary.polished = PolishedSolution();
+        if (config.gradientPolish && fitnessFunction->supportsDerivatives()) {
+            runSummary.polished = polishBestSolution();
+            evaluationCount += runSummary.polished.evaluations;
+            GA_PROFILE_COUNT(profile, ProfileCounter::EVALUATIONS, runSummary.polished.evaluations);
+        }
+        
+        runSummary.generations = statisticsSink->empty() ? 0 : statisticsSink->last().generation;
+        runSummary.evaluations = evaluationCount;
+        runSummary.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - runStartTime).count();
+        runSummary.evaluationsPerSecond = (runSummary.wallSeconds > 0.0) ? evaluationCount / runSummary.wallSeconds : 0.0;
+        runSummary.budgetExhausted = budgetExhausted;
+        runSummary.terminationReason = terminationReason;
+    }
+    
+    // Ask the stopping criterion whether to stop and remember why
+    bool GeneticAlgorithm::checkStoppingCriterion(const GenerationStats& stats) {
+        double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - runStartTime).count();
+        StoppingContext context{stats, currentGeneration, evaluationCount, elapsedSeconds, config.isMaximization};
+        
+        if (stoppingCriterion->shouldStop(context)) {
+            terminationReason = stoppingCriterion->describe();
+            return true;
+        }
+        return false;
+    }
+    
+    // Evolution loop shared by run() and resume()
+    GenerationStats GeneticAlgorithm::runEvolutionLoop() {
+        // The initial population may already have used the whole budget
+        if (checkComputeBudget()) {
+            finishRun();
+            return statisticsSink->last();
+        }
+        
+        for (++currentGeneration; currentGeneration <= config.maxGenerations; ++currentGeneration) {
+            ScopedTraceEvent generationEvent(tracer, "Generation", "generation", currentGeneration);
             GenerationStats stats = evolveGeneration();
-            statistics.push_back(stats);
+            statisticsSink->record(stats);
             
             // Call progress callback
             if (progressCallback) {
                 progressCallback(currentGeneration, stats);
             }
             
-            // Check for convergence
-            if (hasConverged()) {
+            // Periodic checkpoint (also taken at the last generation and when the budget runs out)
+            bool outOfBudget = checkComputeBudget();
+            if (config.checkpointInterval > 0 &&
+                (currentGeneration % config.checkpointInterval == 0 || currentGeneration == config.maxGenerations ||
+                 outOfBudget)) {
+                ScopedTraceEvent checkpointEvent(tracer, "Checkpoint", "io");
+                writeCheckpoint();
+            }
+            
+            if (outOfBudget) {
+                break;
+            }
+            
+            // Check the stopping criterion
+            bool stop;
+            {
+                GA_PHASE_SCOPE(ProfilePhase::CONVERGENCE_CHECK);
+                stop = checkStoppingCriterion(stats);
+            }
+            if (stop) {
                 break;
             }
         }
         
-        return statistics.back();
+        finishRun();
+        return statisticsSink->last();
     }
     
     // Initialize population with random individuals
     void GeneticAlgorithm::initializePopulation() {
-        population.clear();
-        population.reserve(config.populationSize);
+        populationIndexValid = false;
+        populationSummaryValid = false;
+        nicheFitness.clear();
+        nicheRanking.clear();
         
-        // Create random individuals
-        for (int i = 0; i < config.populationSize; ++i) {
-            Individual individual(config.chromosomeLength);
+        // Individuals left from a previous run are re-randomized in place and keep their chromosome buffers
+        population.resize(config.populationSize);
+        for (Individual& individual : population) {
             individual.randomize(config.chromosomeLength, rng);
-            population.push_back(individual);
+            individual.setSelfAdaptiveRate(0.0);
         }
     }
     
     // Evaluate fitness for all individuals
     void GeneticAlgorithm::evaluatePopulation() {
-        // First pass: calculate raw fitness values
-        for (Individual& individual : population) {
-            if (!individual.isFitnessValid()) {
-                FitnessValue fitness = fitnessFunction->evaluateIndividual(individual, config.minValue, config.maxValue);
-                individual.setFitness(fitness);
-            }
-        }
+        GA_PHASE_SCOPE(ProfilePhase::EVALUATION);
+        populationIndexValid = false;
+        populationSummaryValid = false;
+        nicheFitness.clear();
+        nicheRanking.clear();
         
-        // Second pass: calculate fitness percentages
-        if (!population.empty()) {
-            // Find best and worst fitness values in current population
-            double bestFitness = population[0].getFitness();
-            double worstFitness = population[0].getFitness();
+        // Evaluations still allowed by the budget and the deadline (checked before every batch)
+        bool limited = config.maxEvaluations > 0 || config.timeLimitSeconds > 0.0;
+        uint64_t allowance = (config.maxEvaluations > 0)
+                                 ? config.maxEvaluations - std::min(evaluationCount, config.maxEvaluations)
+                                 : std::numeric_limits<uint64_t>::max();
+        auto deadline = runStartTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                           std::chrono::duration<double>(config.timeLimitSeconds));
+        std::atomic<uint64_t> claimed(0);
+        std::atomic<bool> limitHit(false);
+        size_t batchLimit = std::max<size_t>(1, fitnessFunction->getPreferredBatchSize());
+        
+        // First pass: calculate raw fitness values, chunked across the evaluation threads
+        // and handed to the fitness function in batches of decoded values
+        std::atomic<uint64_t> evaluations(0);
+        auto evaluateRange = [&](size_t begin, size_t end, int worker) {
+            if (worker > 0 && tracer.isEnabled()) {
+                tracer.setThreadName("Evaluation worker " + std::to_string(worker));
+            }
+            ScopedTraceEvent chunkEvent(tracer, "Evaluate chunk", "evaluation", static_cast<int64_t>(end - begin));
             
-            for (const Individual& individual : population) {
-                double fitness = individual.getFitness();
-                if (config.isMaximization) {
-                    bestFitness = std::max(bestFitness, fitness);
-                    worstFitness = std::min(worstFitness, fitness);
-                } else {
-                    bestFitness = std::min(bestFitness, fitness);
-                    worstFitness = std::max(worstFitness, fitness);
+            std::vector<size_t> batch;
+            std::vector<double> decoded;
+            std::vector<FitnessValue> fitness;
+            uint64_t chunkEvaluations = 0;
+            size_t i = begin;
+            bool stop = false;
+            while (i < end && !stop) {
+                if (config.timeLimitSeconds > 0.0 && std::chrono::steady_clock::now() >= deadline) {
+                    limitHit = true;
+                    break;
                 }
+                
+                // Gather unevaluated individuals; each one claims a unit of the budget
+                batch.clear();
+                decoded.clear();
+                for (; i < end && batch.size() < batchLimit; ++i) {
+                    Individual& individual = population[i];
+                    if (individual.isFitnessValid()) {
+                        continue;
+                    }
+                    if (limited && (limitHit.load(std::memory_order_relaxed) || claimed.fetch_add(1) >= allowance)) {
+                        limitHit = true;
+                        stop = true;
+                        break;
+                    }
+                    batch.push_back(i);
+                    decoded.push_back(individual.decodeToValue(config.minValue, config.maxValue));
+                }
+                
+                fitness.resize(batch.size());
+                fitnessFunction->evaluateBatch(decoded.data(), fitness.data(), batch.size());
+                for (size_t k = 0; k < batch.size(); ++k) {
+                    population[batch[k]].setFitness(fitness[k]);
+                }
+                chunkEvaluations += batch.size();
             }
+            evaluations += chunkEvaluations;
+        };
+        
+        if (fitnessFunction->supportsAsyncEvaluation()) {
+            // Latency-bound objective: start every pending evaluation on one event loop and
+            // wait for them together (evaluations already started finish past a deadline)
+            ScopedTraceEvent awaitEvent(tracer, "Await evaluations", "evaluation");
+            EvaluationLoop loop;
+            size_t outstanding = 0;
+            std::exception_ptr evaluationError;
+            for (size_t i = 0; i < population.size(); ++i) {
+                Individual& individual = population[i];
+                if (individual.isFitnessValid()) {
+                    continue;
+                }
+                if (limited && ((config.timeLimitSeconds > 0.0 && std::chrono::steady_clock::now() >= deadline) ||
+                                claimed.fetch_add(1) >= allowance)) {
+                    limitHit = true;
+                    break;
+                }
+                
+                outstanding++;
+                fitnessFunction->evaluateAsync(
+                    individual.decodeToValue(config.minValue, config.maxValue), loop,
+                    [&, i](FitnessValue fitness, std::exception_ptr error) {
+                        if (error) {
+                            if (!evaluationError) {
+                                evaluationError = error;
+                            }
+                        } else {
+                            population[i].setFitness(fitness);
+                            evaluations++;
+                        }
+                        outstanding--;
+                    });
+            }
+            loop.runUntil([&] { return outstanding == 0; });
             
-            // Calculate percentage for each individual
-            for (Individual& individual : population) {
-                double fitnessValue = individual.getFitness();
-                double percentage = fitnessFunction->calculateFitnessPercentage(fitnessValue, bestFitness, worstFitness);
-                individual.setFitnessPercentage(percentage);
+            if (evaluationError) {
+                std::rethrow_exception(evaluationError);
             }
+        } else if (ThreadPool* pool = getWorkerPool()) {
+            pool->parallelFor(population.size(), evaluateRange, EVALUATION_CHUNK_MIN);
+        } else {
+            evaluateRange(0, population.size(), 0);
+        }
+        evaluationCount += evaluations.load();
+        GA_PROFILE_COUNT(profile, ProfileCounter::EVALUATIONS, evaluations.load());
+        GA_PROFILE_COUNT(profile, ProfileCounter::CACHE_HITS, population.size() - evaluations.load());
+        
+        // A compute limit stopped evaluation part way: keep only evaluated individuals
+        if (limitHit) {
+            // Statistics need at least one individual, so a fully unevaluated population keeps its first
+            bool anyValid = std::any_of(population.begin(), population.end(),
+                                        [](const Individual& individual) { return individual.isFitnessValid(); });
+            if (!anyValid && !population.empty()) {
+                Individual& first = population.front();
+                first.setFitness(fitnessFunction->evaluateIndividual(first, config.minValue, config.maxValue));
+                evaluationCount++;
+            }
+            
+            population.erase(std::remove_if(population.begin(), population.end(),
+                                            [](const Individual& individual) { return !individual.isFitnessValid(); }),
+                             population.end());
+            checkComputeBudget();
+            if (!budgetExhausted) {
+                budgetExhausted = true;
+                terminationReason = "Compute limit reached";
+            }
+        }
+        
+        // Fused pass: best, worst, sum and fitness percentages
+        if (!population.empty()) {
+            populationSummary = summarizePopulation(population, *fitnessFunction, config.isMaximization, getWorkerPool());
+            populationSummaryValid = true;
         }
     }
     
     // Perform one generation of evolution
     GenerationStats GeneticAlgorithm::evolveGeneration() {
+        if (config.adaptiveRefinement) {
+            refineDomain();
+        }
+        if (config.localSearch != LocalSearchType::NONE && currentGeneration % config.localSearchInterval == 0) {
+            applyLocalSearch();
+        }
+        
+        offspringBred = 0;
+        offspringImproved = 0;
+        GenerationStats stats;
+        if (config.evolutionMode == EvolutionMode::STEADY_STATE) {
+            stats = evolveSteadyState();
+        } else if (config.evolutionMode == EvolutionMode::ASYNCHRONOUS) {
+            stats = evolveAsynchronous();
+        } else {
+            stats = evolveGenerational();
+        }
+        
+        if (rateController) {
+            updateOperatorRates(stats);
+        }
+        return stats;
+    }
+    
+    // Perform one generational step
+    GenerationStats GeneticAlgorithm::evolveGenerational() {
+        #ifndef GA_DISABLE_PROFILING
+        uint64_t allocationsBefore = profileAllocationCount;
+        #endif
+        
         Population newPopulation;
         newPopulation.reserve(config.populationSize);
         
         // Sort population by fitness (best first)
-        sortPopulationByFitness();
+        {
+            GA_PHASE_SCOPE(ProfilePhase::SORT);
+            sortPopulationByFitness();
+        }
+        
+        // Niche fitness steers elites and parent selection towards every peak
+        if (config.niching != NichingType::NONE) {
+            GA_PHASE_SCOPE(ProfilePhase::NICHING);
+            updateNicheFitness();
+        }
         
         // Apply elitism - keep best individuals
         int eliteCount = static_cast<int>(config.populationSize * config.elitismRate);
-        std::vector<Individual> elites = eliteSelection(eliteCount);
-        
-        // Add elite individuals to new population
-        for (const Individual& elite : elites) {
-            newPopulation.push_back(elite);
+        size_t elitesInserted;                    // eliteSelection falls back to 10% when eliteCount is 0
+        {
+            GA_PHASE_SCOPE(ProfilePhase::ELITE_SELECTION);
+            std::vector<Individual> elites = eliteSelection(eliteCount);
+            elitesInserted = elites.size();
+            
+            // Add elite individuals to new population
+            for (const Individual& elite : elites) {
+                newPopulation.push_back(elite);
+            }
         }
         
         // Generate offspring to fill the rest of the population
+        if (config.breedingChunkSize > 0) {
+            breedChunks(newPopulation, eliteCount);
+        }
         while (newPopulation.size() < static_cast<size_t>(config.populationSize)) {
-            // Select parents based on selection strategy
-            Individual parent1, parent2;
+            std::pair<Individual, Individual> offspring = breedOffspring(eliteCount);
             
-            switch (config.selectionType) {
-                case SelectionType::TOURNAMENT:
-                    parent1 = tournamentSelection(config.tournamentSize);
-                    parent2 = tournamentSelection(config.tournamentSize);
-                    break;
-                    
-                case SelectionType::ROULETTE_WHEEL:
-                    parent1 = rouletteWheelSelection();
-                    parent2 = rouletteWheelSelection();
-                    break;
-                    
-                case SelectionType::ELITISM:
-                    // For elitism selection, select from top performers
-                    {
-                        std::uniform_int_distribution<int> dist(0, std::min(eliteCount * 2, config.populationSize - 1));
-                        parent1 = population[dist(rng)];
-                        parent2 = population[dist(rng)];
-                    }
-                    break;
+            // Add offspring to new population (if there's space)
+            if (newPopulation.size() < static_cast<size_t>(config.populationSize)) {
+                newPopulation.push_back(offspring.first);
+            }
+            if (newPopulation.size() < static_cast<size_t>(config.populationSize)) {
+                newPopulation.push_back(offspring.second);
+            }
+        }
+        
+        #ifndef GA_DISABLE_PROFILING
+        profile.addCounter(ProfileCounter::ALLOCATIONS, profileAllocationCount - allocationsBefore);
+        #endif
+        
+        // Replace old population with new population
+        population = std::move(newPopulation);
+        populationSummaryValid = false;
+        
+        // Evaluate new population
+        evaluatePopulation();
+        
+        // Offspring follow the elites (unless a budget cut dropped unevaluated ones)
+        if (config.rateControl == RateControlType::ONE_FIFTH_SUCCESS) {
+            for (size_t i = elitesInserted; i < population.size(); ++i) {
+                recordOffspringSuccess(population[i]);
+            }
+        }
+        
+        // Calculate and return statistics for this generation
+        GA_PHASE_SCOPE(ProfilePhase::STATISTICS);
+        return calculateGenerationStats();
+    }
+    
+    // Select parents, recombine and mutate (timed per phase, shared generator)
+    std::pair<Individual, Individual> GeneticAlgorithm::breedOffspring(int eliteCount) {
+        std::pair<Individual, Individual> parents;
+        {
+            GA_PHASE_SCOPE(ProfilePhase::PARENT_SELECTION);
+            parents = selectParents(eliteCount, rng);
+        }
+        
+        std::pair<Individual, Individual> offspring;
+        {
+            GA_PHASE_SCOPE(ProfilePhase::CROSSOVER);
+            offspring = recombine(parents.first, parents.second, rng);
+        }
+        
+        // Apply mutation to offspring
+        {
+            GA_PHASE_SCOPE(ProfilePhase::MUTATION);
+            performMutation(offspring.first, rng);
+            performMutation(offspring.second, rng);
+        }
+        
+        return offspring;
+    }
+    
+    // Zoom the domain in on the population's best individual
+    bool GeneticAlgorithm::refineDomain() {
+        const int maxBits = std::numeric_limits<double>::digits;  // Finer grids are not representable in the decoded double
+        
+        double width = config.maxValue - config.minValue;
+        int length = config.chromosomeLength;
+        double gridIntervals = std::ldexp(1.0, length) - 1.0;
+        if (population.empty() || width <= 0.0 || width / gridIntervals <= config.targetPrecision) {
+            return false;
+        }
+        
+        // Next window: grid-aligned on the best individual, moved by whole steps to stay inside the domain
+        if (!populationSummaryValid) {
+            populationSummary = summarizePopulation(population, *fitnessFunction, config.isMaximization, getWorkerPool());
+            populationSummaryValid = true;
+        }
+        double center = population[populationSummary.bestIndex].decodeToValue(config.minValue, config.maxValue);
+        int newLength = std::max(length, std::min(maxBits, length + config.refinementBits));
+        double newWidth = width * config.refinementShrink;
+        double newIntervals = std::ldexp(1.0, newLength) - 1.0;
+        double newStep = newWidth / newIntervals;
+        if (newWidth <= 64.0 * std::numeric_limits<double>::epsilon() * std::max(1.0, std::abs(center))) {
+            return false;
+        }
+        
+        double newMin = center - (std::ldexp(1.0, newLength - 1) - 1.0) * newStep;
+        if (newMin < config.minValue) {
+            newMin += std::ceil((config.minValue - newMin) / newStep) * newStep;
+        }
+        if (newMin + newIntervals * newStep > config.maxValue) {
+            newMin -= std::ceil((newMin + newIntervals * newStep - config.maxValue) / newStep) * newStep;
+        }
+        double newMax = newMin + newIntervals * newStep;
+        
+        // Only zoom once the population has concentrated around the best (and the run's best is kept)
+        auto inWindow = [&](const Individual& individual) {
+            double value = individual.decodeToValue(config.minValue, config.maxValue);
+            return value >= newMin && value <= newMax;
+        };
+        size_t inside = static_cast<size_t>(std::count_if(population.begin(), population.end(), inWindow));
+        if (inside < config.refinementConcentration * population.size() || (hasBestSoFar && !inWindow(bestSoFar))) {
+            return false;
+        }
+        
+        {
+            GA_PHASE_SCOPE(ProfilePhase::REFINEMENT);
+            
+            // In-flight asynchronous evaluations use the old encoding
+            if (asyncEvaluator) {
+                evaluationCount += asyncEvaluator->cancel();
+            }
+            
+            for (Individual& individual : population) {
+                if (inWindow(individual)) {
+                    individual.encodeValue(individual.decodeToValue(config.minValue, config.maxValue), newMin, newMax, newLength);
+                } else {
+                    individual.randomize(newLength, rng);
+                }
+            }
+            // The run's best keeps its fitness; the finer grid moves it by at most half a step
+            if (hasBestSoFar) {
+                FitnessValue bestFitness = bestSoFar.getFitness();
+                bestSoFar.encodeValue(bestSoFar.decodeToValue(config.minValue, config.maxValue), newMin, newMax, newLength);
+                bestSoFar.setFitness(bestFitness);
             }
             
-            // Apply crossover
-            std::uniform_real_distribution<double> crossoverDist(0.0, 1.0);
-            if (crossoverDist(rng) < config.crossoverRate) {
-                auto offspring = performCrossover(parent1, parent2);
+            config.minValue = newMin;
+            config.maxValue = newMax;
+            config.chromosomeLength = newLength;
+            populationIndexValid = false;
+            populationSummaryValid = false;
+            refinementCount++;
+        }
+        
+        evaluatePopulation();
+        return true;
+    }
+    
+    // Polish the best individuals in place
+    void GeneticAlgorithm::applyLocalSearch() {
+        size_t count = std::min(population.size(), static_cast<size_t>(config.localSearchElites));
+        if (count == 0 || checkComputeBudget()) {
+            return;
+        }
+        
+        uint64_t perIndividual = static_cast<uint64_t>(config.localSearchEvaluations);
+        if (config.maxEvaluations > 0) {
+            perIndividual = std::min(perIndividual, (config.maxEvaluations - evaluationCount) / count);
+        }
+        if (perIndividual == 0) {
+            return;
+        }
+        
+        GA_PHASE_SCOPE(ProfilePhase::LOCAL_SEARCH);
+        
+        // Best individuals first (ties by slot, so the choice is deterministic)
+        std::vector<size_t> ranked(population.size());
+        std::iota(ranked.begin(), ranked.end(), 0);
+        std::partial_sort(ranked.begin(), ranked.begin() + count, ranked.end(), [&](size_t left, size_t right) {
+            FitnessValue a = population[left].getFitness();
+            FitnessValue b = population[right].getFitness();
+            if (a != b) {
+                return config.isMaximization ? a > b : a < b;
+            }
+            return left < right;
+        });
+        
+        LocalSearch search(*fitnessFunction, config);
+        std::vector<uint64_t> used(count, 0);
+        auto polishRange = [&](size_t begin, size_t end, int) {
+            for (size_t i = begin; i < end; ++i) {
+                used[i] = search.improve(population[ranked[i]], perIndividual);
+            }
+        };
+        if (ThreadPool* pool = getWorkerPool()) {
+            pool->parallelFor(count, polishRange, 1);
+        } else {
+            polishRange(0, count, 0);
+        }
+        
+        uint64_t evaluations = std::accumulate(used.begin(), used.end(), uint64_t(0));
+        evaluationCount += evaluations;
+        GA_PROFILE_COUNT(profile, ProfileCounter::EVALUATIONS, evaluations);
+        populationIndexValid = false;
+        populationSummaryValid = false;
+        
+        // A polished individual may be replaced before the next statistics, so record it now
+        for (size_t i = 0; i < count; ++i) {
+            const Individual& polished = population[ranked[i]];
+            if (!hasBestSoFar || (config.isMaximization ? polished.getFitness() > bestSoFar.getFitness()
+                                                        : polished.getFitness() < bestSoFar.getFitness())) {
+                bestSoFar = polished;
+                hasBestSoFar = true;
+            }
+        }
+    }
+    
+    // Fill the offspring slots chunk by chunk, each chunk with its own generator
+    void GeneticAlgorithm::breedChunks(Population& newPopulation, int eliteCount) {
+        GA_PHASE_SCOPE(ProfilePhase::BREEDING);
+        
+        size_t first = newPopulation.size();
+        size_t total = static_cast<size_t>(config.populationSize);
+        if (first >= total) {
+            return;
+        }
+        newPopulation.resize(total);
+        
+        // One draw from the shared generator per generation; chunk c is seeded from
+        // (generationSeed, c), so offspring do not depend on which thread bred them
+        uint32_t generationSeed = static_cast<uint32_t>(rng());
+        size_t chunk = static_cast<size_t>(config.breedingChunkSize);
+        size_t chunkCount = (total - first + chunk - 1) / chunk;
+        std::atomic<uint64_t> allocations{0};
+        
+        auto breedRange = [&](size_t begin, size_t end, int worker) {
+            #ifndef GA_DISABLE_PROFILING
+            uint64_t allocationsBefore = profileAllocationCount;
+            #else
+            (void)worker;
+            #endif
+            for (size_t c = begin; c < end; ++c) {
+                std::seed_seq seed{generationSeed, static_cast<uint32_t>(c)};
+                std::mt19937 generator(seed);
+                size_t slot = first + c * chunk;
+                size_t slotEnd = std::min(slot + chunk, total);
+                while (slot < slotEnd) {
+                    std::pair<Individual, Individual> parents = selectParents(eliteCount, generator);
+                    std::pair<Individual, Individual> offspring = recombine(parents.first, parents.second, generator);
+                    performMutation(offspring.first, generator);
+                    newPopulation[slot++] = std::move(offspring.first);
+                    if (slot < slotEnd) {
+                        performMutation(offspring.second, generator);
+                        newPopulation[slot++] = std::move(offspring.second);
+                    }
+                }
+            }
+            #ifndef GA_DISABLE_PROFILING
+            if (worker > 0) {
+                allocations += profileAllocationCount - allocationsBefore;
+            }
+            #endif
+        };
+        
+        if (ThreadPool* pool = getWorkerPool()) {
+            pool->parallelFor(chunkCount, breedRange, 1);
+        } else {
+            breedRange(0, chunkCount, 0);
+        }
+        
+        // The calling thread's allocations are already in its own thread-local count
+        GA_PROFILE_COUNT(profile, ProfileCounter::ALLOCATIONS, allocations.load());
+    }
+    
+    // Select two parents based on the selection strategy
+    std::pair<Individual, Individual> GeneticAlgorithm::selectParents(int eliteCount, std::mt19937& generator) {
+        std::pair<Individual, Individual> parents;
+        switch (config.selectionType) {
+            case SelectionType::TOURNAMENT:
+                parents.first = tournamentSelection(config.tournamentSize, generator);
+                parents.second = tournamentSelection(config.tournamentSize, generator);
+                break;
                 
-                // Apply mutation to offspring
-                performMutation(offspring.first);
-                performMutation(offspring.second);
+            case SelectionType::ROULETTE_WHEEL:
+                parents.first = rouletteWheelSelection(generator);
+                parents.second = rouletteWheelSelection(generator);
+                break;
                 
-                // Add offspring to new population (if there's space)
-                if (newPopulation.size() < static_cast<size_t>(config.populationSize)) {
-                    newPopulation.push_back(offspring.first);
+            case SelectionType::ELITISM:
+                // For elitism selection, select from top performers (by rank; the
+                // steady-state population is unsorted and ranked through the index,
+                // and niching ranks by niche fitness)
+                {
+                    std::uniform_int_distribution<int> dist(0, std::min(eliteCount * 2, static_cast<int>(population.size()) - 1));
+                    int rank1 = dist(generator);
+                    int rank2 = dist(generator);
+                    if (nicheRanking.size() == population.size()) {
+                        parents.first = population[nicheRanking[rank1]];
+                        parents.second = population[nicheRanking[rank2]];
+                    } else if (populationIndexValid) {
+                        parents.first = population[populationIndex.slotAtRank(rank1)];
+                        parents.second = population[populationIndex.slotAtRank(rank2)];
+                    } else {
+                        parents.first = population[rank1];
+                        parents.second = population[rank2];
+                    }
+                }
+                break;
+        }
+        return parents;
+    }
+    
+    // Apply crossover (parents are copied unchanged when it is skipped)
+    std::pair<Individual, Individual> GeneticAlgorithm::recombine(const Individual& parent1, const Individual& parent2,
+                                                                  std::mt19937& generator) {
+        std::uniform_real_distribution<double> crossoverDist(0.0, 1.0);
+        bool crossed = crossoverDist(generator) < config.crossoverRate;
+        std::pair<Individual, Individual> offspring = crossed ? performCrossover(parent1, parent2, generator)
+                                                              : std::make_pair(parent1, parent2);
+        
+        if (config.rateControl == RateControlType::ONE_FIFTH_SUCCESS) {
+            // Copies compete with their own parent, recombined offspring with the better one
+            FitnessValue first = parent1.getFitness();
+            FitnessValue second = parent2.getFitness();
+            FitnessValue better = (config.isMaximization ? first >= second : first <= second) ? first : second;
+            offspring.first.setParentFitness(crossed ? better : first);
+            offspring.second.setParentFitness(crossed ? better : second);
+        } else if (config.rateControl == RateControlType::SELF_ADAPTIVE && crossed) {
+            // Strategy parameters recombine intermediately (geometric mean of the parents' rates)
+            auto carried = [this](const Individual& parent) {
+                return parent.getSelfAdaptiveRate() > 0.0 ? parent.getSelfAdaptiveRate() : config.mutationRate;
+            };
+            double rate = std::sqrt(carried(parent1) * carried(parent2));
+            offspring.first.setSelfAdaptiveRate(rate);
+            offspring.second.setSelfAdaptiveRate(rate);
+        }
+        return offspring;
+    }
+    
+    // Workers shared by parallel evaluation and breeding (nullptr = calling thread only)
+    ThreadPool* GeneticAlgorithm::getWorkerPool() {
+        if (config.evaluationThreads == 1) {
+            return nullptr;
+        }
+        
+        int threads = config.evaluationThreads > 0
+                          ? config.evaluationThreads
+                          : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        if (!evaluationPool || evaluationPool->getThreadCount() != threads) {
+            evaluationPool = std::make_unique<ThreadPool>(threads);
+        }
+        return evaluationPool.get();
+    }
+    
+    // Perform one steady-state generation
+    GenerationStats GeneticAlgorithm::evolveSteadyState() {
+        #ifndef GA_DISABLE_PROFILING
+        uint64_t allocationsBefore = profileAllocationCount;
+        #endif
+        
+        // The index is rebuilt only after the population was replaced wholesale
+        if (!populationIndexValid) {
+            GA_PHASE_SCOPE(ProfilePhase::SORT);
+            populationIndex.rebuild(population, config.isMaximization);
+            populationIndexValid = true;
+        }
+        
+        int eliteCount = static_cast<int>(config.populationSize * config.elitismRate);
+        size_t offspringPerStep = static_cast<size_t>(config.steadyStateOffspring);
+        std::vector<Individual> offspring;
+        offspring.reserve(offspringPerStep + 1);
+        
+        int produced = 0;
+        while (produced < config.populationSize && !checkComputeBudget()) {
+            // Breed k offspring from the current population
+            offspring.clear();
+            while (offspring.size() < offspringPerStep) {
+                std::pair<Individual, Individual> children = breedOffspring(eliteCount);
+                offspring.push_back(children.first);
+                if (offspring.size() < offspringPerStep) {
+                    offspring.push_back(children.second);
                 }
-                if (newPopulation.size() < static_cast<size_t>(config.populationSize)) {
-                    newPopulation.push_back(offspring.second);
+            }
+            
+            // Evaluate and insert each offspring at once so the next step can select it
+            for (Individual& child : offspring) {
+                if (produced >= config.populationSize || checkComputeBudget()) {
+                    break;
                 }
-            } else {
-                // No crossover, just copy parents with potential mutation
-                Individual child1 = parent1;
-                Individual child2 = parent2;
                 
-                performMutation(child1);
-                performMutation(child2);
+                // Offspring identical to a parent carry its fitness forward
+                if (child.isFitnessValid()) {
+                    GA_PROFILE_COUNT(profile, ProfileCounter::CACHE_HITS, 1);
+                } else {
+                    GA_PHASE_SCOPE(ProfilePhase::EVALUATION);
+                    child.setFitness(fitnessFunction->evaluateIndividual(child, config.minValue, config.maxValue));
+                    evaluationCount++;
+                    GA_PROFILE_COUNT(profile, ProfileCounter::EVALUATIONS, 1);
+                }
                 
-                if (newPopulation.size() < static_cast<size_t>(config.populationSize)) {
-                    newPopulation.push_back(child1);
+                insertOffspring(child);
+                produced++;
+            }
+        }
+        
+        #ifndef GA_DISABLE_PROFILING
+        profile.addCounter(ProfileCounter::ALLOCATIONS, profileAllocationCount - allocationsBefore);
+        #endif
+        
+        GA_PHASE_SCOPE(ProfilePhase::STATISTICS);
+        return calculateSteadyStateStats();
+    }
+    
+    // Perform one asynchronous generation
+    GenerationStats GeneticAlgorithm::evolveAsynchronous() {
+        #ifndef GA_DISABLE_PROFILING
+        uint64_t allocationsBefore = profileAllocationCount;
+        #endif
+        
+        if (!populationIndexValid) {
+            GA_PHASE_SCOPE(ProfilePhase::SORT);
+            populationIndex.rebuild(population, config.isMaximization);
+            populationIndexValid = true;
+        }
+        
+        int threads = config.evaluationThreads > 0
+                          ? config.evaluationThreads
+                          : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        if (!asyncEvaluator || asyncEvaluator->getThreadCount() != threads) {
+            asyncEvaluator.reset();
+            asyncEvaluator = std::make_unique<AsyncEvaluator>(threads, [this](const Individual& individual, int worker) {
+                if (tracer.isEnabled()) {
+                    tracer.setThreadName("Async worker " + std::to_string(worker));
+                }
+                ScopedTraceEvent evaluationEvent(tracer, "Evaluate", "evaluation");
+                return fitnessFunction->evaluateIndividual(individual, config.minValue, config.maxValue);
+            });
+        }
+        
+        // Two candidates per worker keep every worker busy while the master inserts a result
+        size_t window = 2 * static_cast<size_t>(threads);
+        int eliteCount = static_cast<int>(config.populationSize * config.elitismRate);
+        int produced = 0;
+        auto submitIfAllowed = [&](const Individual& candidate) {
+            // Offspring identical to a parent carry its fitness and skip the workers
+            if (candidate.isFitnessValid()) {
+                GA_PROFILE_COUNT(profile, ProfileCounter::CACHE_HITS, 1);
+                if (produced < config.populationSize) {
+                    insertOffspring(candidate);
+                    produced++;
                 }
-                if (newPopulation.size() < static_cast<size_t>(config.populationSize)) {
-                    newPopulation.push_back(child2);
+                return true;
+            }
+            
+            bool withinBudget = config.maxEvaluations == 0 ||
+                                evaluationCount + asyncEvaluator->getInFlight() < config.maxEvaluations;
+            if (withinBudget) {
+                asyncEvaluator->submit(candidate);
+            }
+            return withinBudget;
+        };
+        
+        while (produced < config.populationSize && !checkComputeBudget()) {
+            // Breed from the current population until the window is full
+            while (asyncEvaluator->getInFlight() < window && produced < config.populationSize) {
+                std::pair<Individual, Individual> children = breedOffspring(eliteCount);
+                if (!submitIfAllowed(children.first) || !submitIfAllowed(children.second)) {
+                    break;
                 }
             }
+            if (asyncEvaluator->getInFlight() == 0) {
+                break;
+            }
+            
+            // Wait for whichever evaluation finishes first
+            Individual child;
+            {
+                GA_PHASE_SCOPE(ProfilePhase::EVALUATION);
+                child = asyncEvaluator->takeResult();
+                evaluationCount++;
+                GA_PROFILE_COUNT(profile, ProfileCounter::EVALUATIONS, 1);
+            }
+            
+            insertOffspring(child);
+            produced++;
         }
         
-        // Replace old population with new population
-        population = std::move(newPopulation);
+        #ifndef GA_DISABLE_PROFILING
+        profile.addCounter(ProfileCounter::ALLOCATIONS, profileAllocationCount - allocationsBefore);
+        #endif
         
-        // Evaluate new population
-        evaluatePopulation();
+        GA_PHASE_SCOPE(ProfilePhase::STATISTICS);
+        return calculateSteadyStateStats();
+    }
+    
+    // Count an offspring that beat its better parent
+    void GeneticAlgorithm::recordOffspringSuccess(const Individual& child) {
+        offspringBred++;
+        FitnessValue fitness = child.getFitness();
+        if (config.isMaximization ? fitness > child.getParentFitness() : fitness < child.getParentFitness()) {
+            offspringImproved++;
+        }
+    }
+    
+    // Let the rate controller set the next generation's rates
+    void GeneticAlgorithm::updateOperatorRates(const GenerationStats& stats) {
+        double successRatio = offspringBred > 0 ? static_cast<double>(offspringImproved) / offspringBred : 0.0;
         
-        // Calculate and return statistics for this generation
-        return calculateGenerationStats();
+        double meanRate = 0.0;
+        if (config.rateControl == RateControlType::SELF_ADAPTIVE && !population.empty()) {
+            for (const Individual& individual : population) {
+                meanRate += individual.getSelfAdaptiveRate() > 0.0 ? individual.getSelfAdaptiveRate() : config.mutationRate;
+            }
+            meanRate /= population.size();
+        }
+        
+        RateFeedback feedback{stats, currentGeneration, config.maxGenerations,
+                              OperatorRates{configuredMutationRate, configuredCrossoverRate},
+                              OperatorRates{config.mutationRate, config.crossoverRate}, successRatio, meanRate};
+        OperatorRates rates = rateController->update(feedback);
+        config.mutationRate = std::max(0.0, std::min(1.0, rates.mutationRate));
+        config.crossoverRate = std::max(0.0, std::min(1.0, rates.crossoverRate));
+    }
+    
+    // Replace an existing individual with an evaluated offspring
+    void GeneticAlgorithm::insertOffspring(const Individual& child) {
+        GA_PHASE_SCOPE(ProfilePhase::REPLACEMENT);
+        if (config.rateControl == RateControlType::ONE_FIFTH_SUCCESS) {
+            recordOffspringSuccess(child);
+        }
+        size_t slot = selectReplacementSlot();
+        populationIndex.replace(population, slot, child);
+        populationSummaryValid = false;
+        population[slot].setFitnessPercentage(fitnessFunction->calculateFitnessPercentage(
+            child.getFitness(), populationIndex.bestFitness(), populationIndex.worstFitness()));
+    }
+    
+    // Choose the individual a steady-state offspring replaces
+    size_t GeneticAlgorithm::selectReplacementSlot() {
+        if (config.replacementStrategy == ReplacementStrategy::WORST || population.size() < 2) {
+            return populationIndex.worstSlot();
+        }
+        
+        // Inverse tournament: the worst of tournamentSize random individuals loses its slot
+        int populationSize = static_cast<int>(population.size());
+        int tournamentSize = config.tournamentSize;
+        if (tournamentSize <= 0 || tournamentSize > populationSize) {
+            tournamentSize = std::min(3, populationSize);
+        }
+        
+        std::uniform_int_distribution<int> dist(0, populationSize - 1);
+        size_t loser = static_cast<size_t>(dist(rng));
+        for (int i = 1; i < tournamentSize; ++i) {
+            size_t competitor = static_cast<size_t>(dist(rng));
+            double competitorFitness = population[competitor].getFitness();
+            double loserFitness = population[loser].getFitness();
+            if (config.isMaximization ? competitorFitness < loserFitness : competitorFitness > loserFitness) {
+                loser = competitor;
+            }
+        }
+        
+        // Never overwrite the best individual
+        return (loser == populationIndex.bestSlot()) ? populationIndex.worstSlot() : loser;
     }
     
     // Tournament selection implementation
     Individual GeneticAlgorithm::tournamentSelection(int tournamentSize) {
-        if (tournamentSize <= 0 || tournamentSize > config.populationSize) {
-            tournamentSize = std::min(3, config.populationSize);  // Default tournament size
+        return tournamentSelection(tournamentSize, rng);
+    }
+    
+    Individual GeneticAlgorithm::tournamentSelection(int tournamentSize, std::mt19937& generator) const {
+        int populationSize = static_cast<int>(population.size());
+        if (tournamentSize <= 0 || tournamentSize > populationSize) {
+            tournamentSize = std::min(3, populationSize);  // Default tournament size
         }
         
-        std::uniform_int_distribution<int> dist(0, config.populationSize - 1);
+        std::uniform_int_distribution<int> dist(0, populationSize - 1);
         
-        // Select random individuals for tournament
-        Individual best = population[dist(rng)];
+        // Select random individuals for tournament (by slot; only the winner is copied)
+        size_t best = static_cast<size_t>(dist(generator));
         
         for (int i = 1; i < tournamentSize; ++i) {
-            Individual competitor = population[dist(rng)];
-            
-            // Select better individual based on maximization/minimization
-            if (config.isMaximization) {
-                if (competitor.getFitness() > best.getFitness()) {
-                    best = competitor;
-                }
-            } else {
-                if (competitor.getFitness() < best.getFitness()) {
-                    best = competitor;
-                }
+            size_t competitor = static_cast<size_t>(dist(generator));
+            if (selectionBetter(competitor, best)) {
+                best = competitor;
             }
         }
         
-        return best;
+        return population[best];
+    }
+    
+    // Niche fitness while niching, otherwise raw fitness by direction
+    bool GeneticAlgorithm::selectionBetter(size_t a, size_t b) const {
+        if (!nicheFitness.empty()) {
+            return nicheFitness[a] > nicheFitness[b];
+        }
+        return config.isMaximization ? population[a].getFitness() > population[b].getFitness()
+                                     : population[a].getFitness() < population[b].getFitness();
     }
     
     // Roulette wheel selection implementation
     Individual GeneticAlgorithm::rouletteWheelSelection() {
+        return rouletteWheelSelection(rng);
+    }
+    
+    Individual GeneticAlgorithm::rouletteWheelSelection(std::mt19937& generator) const {
+        // Niche fitness is already non-negative with higher = better
+        if (!nicheFitness.empty()) {
+            double totalNicheFitness = std::accumulate(nicheFitness.begin(), nicheFitness.end(), 0.0);
+            if (totalNicheFitness <= 0.0) {
+                std::uniform_int_distribution<size_t> slotDist(0, population.size() - 1);
+                return population[slotDist(generator)];
+            }
+            
+            std::uniform_real_distribution<double> pointDist(0.0, totalNicheFitness);
+            double point = pointDist(generator);
+            double cumulative = 0.0;
+            for (size_t slot = 0; slot < population.size(); ++slot) {
+                cumulative += nicheFitness[slot];
+                if (cumulative >= point) {
+                    return population[slot];
+                }
+            }
+            return population.back();
+        }
+        
         // Calculate total fitness
         double totalFitness = 0.0;
         double minFitness = std::numeric_limits<double>::max();
@@ -291,7 +1130,7 @@ namespace GA {
         
         // Generate random selection point
         std::uniform_real_distribution<double> dist(0.0, totalFitness);
-        double selectionPoint = dist(rng);
+        double selectionPoint = dist(generator);
         
         // Select individual based on cumulative fitness
         double cumulativeFitness = 0.0;
@@ -327,14 +1166,24 @@ namespace GA {
             eliteCount = std::max(1, static_cast<int>(config.populationSize * 0.1));  // Default 10%
         }
         
+        std::vector<Individual> elites;
+        elites.reserve(eliteCount);
+        
+        // Top niche fitness
+        if (nicheRanking.size() == population.size() && !population.empty()) {
+            size_t count = std::min(static_cast<size_t>(eliteCount), nicheRanking.size());
+            for (size_t i = 0; i < count; ++i) {
+                elites.push_back(population[nicheRanking[i]]);
+            }
+            return elites;
+        }
+        
         // Sort population by fitness
         sortPopulationByFitness();
         
         // Select top individuals
-        std::vector<Individual> elites;
-        elites.reserve(eliteCount);
-        
-        for (int i = 0; i < eliteCount && i < config.populationSize; ++i) {
+
+        for (int i = 0; i < eliteCount && i < static_cast<int>(population.size()); ++i) {
             elites.push_back(population[i]);
         }
         
@@ -343,17 +1192,22 @@ namespace GA {
     
     // Crossover operation
     std::pair<Individual, Individual> GeneticAlgorithm::performCrossover(const Individual& parent1, const Individual& parent2) {
+        return performCrossover(parent1, parent2, rng);
+    }
+    
+    std::pair<Individual, Individual> GeneticAlgorithm::performCrossover(const Individual& parent1, const Individual& parent2,
+                                                                         std::mt19937& generator) const {
         std::uniform_int_distribution<int> pointDist(1, config.chromosomeLength - 1);
         
         switch (config.crossoverType) {
             case CrossoverType::SINGLE_POINT: {
-                int crossoverPoint = pointDist(rng);
+                int crossoverPoint = pointDist(generator);
                 return parent1.singlePointCrossover(parent2, crossoverPoint);
             }
             
             case CrossoverType::TWO_POINT: {
-                int point1 = pointDist(rng);
-                int point2 = pointDist(rng);
+                int point1 = pointDist(generator);
+                int point2 = pointDist(generator);
                 if (point1 > point2) {
                     std::swap(point1, point2);
                 }
@@ -365,7 +1219,7 @@ namespace GA {
                 Chromosome mask(config.chromosomeLength);
                 std::uniform_int_distribution<int> maskDist(0, 1);
                 for (int i = 0; i < config.chromosomeLength; ++i) {
-                    mask[i] = (maskDist(rng) == 1);
+                    mask[i] = (maskDist(generator) == 1);
                 }
                 return parent1.uniformCrossover(parent2, mask);
             }
@@ -377,7 +1231,22 @@ namespace GA {
     
     // Mutation operation
     void GeneticAlgorithm::performMutation(Individual& individual) {
-        individual.mutate(config.mutationRate, rng);
+        performMutation(individual, rng);
+    }
+    
+    void GeneticAlgorithm::performMutation(Individual& individual, std::mt19937& generator) const {
+        if (config.rateControl != RateControlType::SELF_ADAPTIVE) {
+            individual.mutate(config.mutationRate, generator);
+            return;
+        }
+        
+        // Mutate the carried rate first (logistic log-normal step, Bäck & Schütz), then the bits with it
+        double rate = individual.getSelfAdaptiveRate() > 0.0 ? individual.getSelfAdaptiveRate() : config.mutationRate;
+        std::normal_distribution<double> step(0.0, 1.0);
+        rate = 1.0 / (1.0 + (1.0 - rate) / rate * std::exp(-SELF_ADAPTATION_LEARNING_RATE * step(generator)));
+        rate = std::max(config.minMutationRate, std::min(config.maxMutationRate, rate));
+        individual.setSelfAdaptiveRate(rate);
+        individual.mutate(rate, generator);
     }
     
     // Calculate generation statistics
@@ -386,55 +1255,57 @@ namespace GA {
             throw std::runtime_error("Cannot calculate statistics for empty population");
         }
         
+        // Aggregates left by evaluatePopulation, or a fresh fused pass
+        if (!populationSummaryValid) {
+            populationSummary = summarizePopulation(population, *fitnessFunction, config.isMaximization, getWorkerPool());
+            populationSummaryValid = true;
+        }
+        const Individual& best = population[populationSummary.bestIndex];
+        
         GenerationStats stats;
         stats.generation = currentGeneration;
+        stats.bestFitness = populationSummary.bestFitness;
+        stats.worstFitness = populationSummary.worstFitness;
+        stats.averageFitness = populationSummary.fitnessSum / population.size();
+        stats.bestValue = best.decodeToValue(config.minValue, config.maxValue);
+        stats.convergence = calculatePopulationDiversity();
         
-        // Find best and worst fitness
-        double totalFitness = 0.0;
-        stats.bestFitness = population[0].getFitness();
-        stats.worstFitness = population[0].getFitness();
-        
-        for (const Individual& individual : population) {
-            double fitness = individual.getFitness();
-            totalFitness += fitness;
-            
-            if (config.isMaximization) {
-                if (fitness > stats.bestFitness) {
-                    stats.bestFitness = fitness;
-                    stats.bestValue = individual.decodeToValue(config.minValue, config.maxValue);
-                }
-                if (fitness < stats.worstFitness) {
-                    stats.worstFitness = fitness;
-                }
-            } else {
-                if (fitness < stats.bestFitness) {
-                    stats.bestFitness = fitness;
-                    stats.bestValue = individual.decodeToValue(config.minValue, config.maxValue);
-                }
-                if (fitness > stats.worstFitness) {
-                    stats.worstFitness = fitness;
-                }
-            }
+        // Remember the best individual of the run (copied only on improvement)
+        if (!hasBestSoFar ||
+            (config.isMaximization ? stats.bestFitness > bestSoFar.getFitness() : stats.bestFitness < bestSoFar.getFitness())) {
+            bestSoFar = best;
+            hasBestSoFar = true;
         }
         
-        stats.averageFitness = totalFitness / population.size();
-        stats.convergence = calculatePopulationDiversity();
+        // Best percentage is the highest regardless of min/max problem
+        stats.bestFitnessPercentage = populationSummary.bestPercentage;
+        stats.averageFitnessPercentage = populationSummary.percentageSum / population.size();
         
-        // Calculate fitness percentages
-        double totalPercentage = 0.0;
-        stats.bestFitnessPercentage = 0.0;
+        return stats;
+    }
+    
+    // Statistics from the population index
+    GenerationStats GeneticAlgorithm::calculateSteadyStateStats() {
+        GenerationStats stats;
+        stats.generation = currentGeneration;
         
-        for (const Individual& individual : population) {
-            double percentage = individual.getFitnessPercentage();
-            totalPercentage += percentage;
-            
-            // Find best percentage (highest is always best regardless of min/max problem)
-            if (percentage > stats.bestFitnessPercentage) {
-                stats.bestFitnessPercentage = percentage;
-            }
+        const Individual& best = population[populationIndex.bestSlot()];
+        stats.bestFitness = populationIndex.bestFitness();
+        stats.worstFitness = populationIndex.worstFitness();
+        stats.averageFitness = populationIndex.averageFitness();
+        stats.bestValue = best.decodeToValue(config.minValue, config.maxValue);
+        stats.convergence = populationIndex.diversity();
+        
+        if (!hasBestSoFar ||
+            (config.isMaximization ? stats.bestFitness > bestSoFar.getFitness() : stats.bestFitness < bestSoFar.getFitness())) {
+            bestSoFar = best;
+            hasBestSoFar = true;
         }
         
-        stats.averageFitnessPercentage = totalPercentage / population.size();
+        // Percentages against the current best and worst (stored percentages keep their insertion-time range)
+        PercentageScale scale = fitnessFunction->getPercentageScale(stats.bestFitness, stats.worstFitness);
+        stats.bestFitnessPercentage = scale.apply(stats.bestFitness);
+        stats.averageFitnessPercentage = scale.apply(stats.averageFitness);
         
         return stats;
     }
@@ -461,6 +1332,49 @@ namespace GA {
         return best;
     }
     
+    // Get best individual of the run
+    Individual GeneticAlgorithm::getBestSoFar() const {
+        return hasBestSoFar ? bestSoFar : getBestIndividual();
+    }
+    
+    // Sharing or clearing over the population sorted by decoded value
+    void GeneticAlgorithm::updateNicheFitness() {
+        niching.compute(population, config, nicheFitness);
+        
+        // Slot order breaks ties, so the sorted population's best ranks first
+        nicheRanking.resize(population.size());
+        std::iota(nicheRanking.begin(), nicheRanking.end(), size_t(0));
+        std::sort(nicheRanking.begin(), nicheRanking.end(), [this](size_t a, size_t b) {
+            return nicheFitness[a] > nicheFitness[b] || (nicheFitness[a] == nicheFitness[b] && a < b);
+        });
+    }
+    
+    // Niche winners of the current population
+    std::vector<Individual> GeneticAlgorithm::getNichePeaks(double radius) const {
+        Niching peakFinder;
+        std::vector<size_t> slots = peakFinder.findPeaks(population, config, (radius > 0.0) ? radius : config.nicheRadius);
+        
+        std::vector<Individual> peaks;
+        peaks.reserve(slots.size());
+        for (size_t slot : slots) {
+            peaks.push_back(population[slot]);
+        }
+        return peaks;
+    }
+    
+    // Newton-polish the decoded best-so-far value over the configured domain
+    PolishedSolution GeneticAlgorithm::polishBestSolution(int maxIterations) const {
+        GAConfig domain = config;
+        domain.minValue = configuredMinValue;
+        domain.maxValue = configuredMaxValue;
+        double start = getBestSoFar().decodeToValue(config.minValue, config.maxValue);
+        return LocalSearch(*fitnessFunction, domain).newtonPolish(start, maxIterations);
+    }
+    
+    const RunSummary& GeneticAlgorithm::getRunSummary() const {
+        return runSummary;
+    }
+    
     // Get worst individual
     Individual GeneticAlgorithm::getWorstIndividual() const {
         if (population.empty()) {
@@ -489,32 +1403,37 @@ namespace GA {
             return 0.0;
         }
         
-        // Calculate average Hamming distance between all pairs of individuals
-        double totalDistance = 0.0;
-        int comparisons = 0;
+        // Average Hamming distance between all pairs of individuals: bit k
+        // differs in ones_k * (N - ones_k) pairs
+        size_t length = population[0].getChromosome().size();
+        if (length == 0) {
+            return 0.0;
+        }
         
-        for (size_t i = 0; i < population.size(); ++i) {
-            for (size_t j = i + 1; j < population.size(); ++j) {
-                const Chromosome& chrom1 = population[i].getChromosome();
-                const Chromosome& chrom2 = population[j].getChromosome();
-                
-                int hammingDistance = 0;
-                for (size_t k = 0; k < chrom1.size(); ++k) {
-                    if (chrom1[k] != chrom2[k]) {
-                        hammingDistance++;
-                    }
-                }
-                
-                totalDistance += static_cast<double>(hammingDistance) / chrom1.size();
-                comparisons++;
+        std::vector<uint32_t> ones(length, 0);
+        for (const Individual& individual : population) {
+            const Chromosome& chromosome = individual.getChromosome();
+            for (size_t k = 0; k < length; ++k) {
+                ones[k] += chromosome[k] ? 1 : 0;
             }
         }
         
-        return (comparisons > 0) ? totalDistance / comparisons : 0.0;
+        double count = static_cast<double>(population.size());
+        double differingPairs = 0.0;
+        for (uint32_t onesAtBit : ones) {
+            differingPairs += static_cast<double>(onesAtBit) * (count - onesAtBit);
+        }
+        
+        double pairs = count * (count - 1.0) / 2.0;
+        return differingPairs / (pairs * length);
     }
     
     // Sort population by fitness
     void GeneticAlgorithm::sortPopulationByFitness() {
+        populationIndexValid = false;
+        populationSummaryValid = false;
+        nicheFitness.clear();
+        nicheRanking.clear();
         if (config.isMaximization) {
             // Sort in descending order for maximization (best first)
             std::sort(population.begin(), population.end(), 
@@ -537,9 +1456,189 @@ namespace GA {
     
     // Reset algorithm
     void GeneticAlgorithm::reset() {
+        if (asyncEvaluator) {
+            asyncEvaluator->cancel();
+        }
         population.clear();
-        statistics.clear();
+        statisticsSink->clear();
+        profile.reset();
+        hasBestSoFar = false;
+        populationIndexValid = false;
+        populationSummaryValid = false;
         currentGeneration = 0;
+        config.minValue = configuredMinValue;
+        config.maxValue = configuredMaxValue;
+        config.chromosomeLength = configuredChromosomeLength;
+        config.mutationRate = configuredMutationRate;
+        config.crossoverRate = configuredCrossoverRate;
+    }
+    
+    // Capture the resumable state
+    void GeneticAlgorithm::captureCheckpoint(CheckpointData& data) const {
+        data.config = config;
+        data.generation = currentGeneration;
+        data.functionName = fitnessFunction->getName();
+        data.functionExpression = fitnessFunction->getExpression();
+        
+        // Serialize the generator through its standard text form and keep the words
+        std::ostringstream rngStream;
+        rngStream << rng;
+        std::istringstream rngWords(rngStream.str());
+        data.rngState.clear();
+        uint32_t word;
+        while (rngWords >> word) {
+            data.rngState.push_back(word);
+        }
+        
+        // Columnar population: packed chromosomes plus fitness columns
+        size_t count = population.size();
+        data.chromosomeLength = config.chromosomeLength;
+        data.wordsPerIndividual = (static_cast<size_t>(config.chromosomeLength) + 63) / 64;
+        data.packedChromosomes.resize(count * data.wordsPerIndividual);
+        data.fitness.resize(count);
+        data.fitnessPercentage.resize(count);
+        data.fitnessValid.resize(count);
+        data.selfAdaptiveRates.clear();
+        if (config.rateControl == RateControlType::SELF_ADAPTIVE) {
+            data.selfAdaptiveRates.resize(count);
+        }
+        
+        for (size_t i = 0; i < count; ++i) {
+            const Individual& individual = population[i];
+            individual.packChromosome(&data.packedChromosomes[i * data.wordsPerIndividual]);
+            data.fitnessValid[i] = individual.isFitnessValid() ? 1 : 0;
+            data.fitness[i] = individual.isFitnessValid() ? individual.getFitness() : 0.0;
+            data.fitnessPercentage[i] = individual.getFitnessPercentage();
+            if (!data.selfAdaptiveRates.empty()) {
+                data.selfAdaptiveRates[i] = individual.getSelfAdaptiveRate();
+            }
+        }
+        
+        data.statistics = statisticsSink->getRetained();
+        
+        // Spent budget and the best individual so far carry over into the resumed run
+        data.evaluationCount = evaluationCount;
+        data.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - runStartTime).count();
+        data.hasBestSoFar = hasBestSoFar;
+        data.bestSoFarLength = hasBestSoFar ? static_cast<int>(bestSoFar.getChromosomeLength()) : 0;
+        data.bestSoFarChromosome.resize((static_cast<size_t>(data.bestSoFarLength) + 63) / 64);
+        if (hasBestSoFar) {
+            bestSoFar.packChromosome(data.bestSoFarChromosome.data());
+        }
+        data.bestSoFarFitness = hasBestSoFar ? bestSoFar.getFitness() : 0.0;
+        
+        // Taken before this generation's stopping check, which resume() repeats
+        data.hasCriterionState = true;
+        data.criterionState.clear();
+        stoppingCriterion->saveState(data.criterionState);
+        
+        data.initialMutationRate = configuredMutationRate;
+        data.initialCrossoverRate = configuredCrossoverRate;
+        data.initialMinValue = configuredMinValue;
+        data.initialMaxValue = configuredMaxValue;
+        data.initialChromosomeLength = configuredChromosomeLength;
+        data.refinementCount = refinementCount;
+    }
+    
+    // Restore the resumable state
+    void GeneticAlgorithm::restoreCheckpoint(const CheckpointData& data) {
+        if (data.functionName != fitnessFunction->getName() ||
+            data.functionExpression != fitnessFunction->getExpression()) {
+            throw std::runtime_error("Checkpoint was written for a different fitness function: " +
+                                     data.functionExpression);
+        }
+        if (data.statistics.empty()) {
+            throw std::runtime_error("Checkpoint does not contain any generation statistics");
+        }
+        
+        // Keep output settings of this process, restore everything that drives evolution
+        GAConfig restored = data.config;
+        restored.checkpointInterval = config.checkpointInterval;
+        restored.checkpointPath = config.checkpointPath;
+        restored.evaluationThreads = config.evaluationThreads;
+        restored.traceOutputPath = config.traceOutputPath;
+        restored.collectHardwareCounters = config.collectHardwareCounters;
+        restored.gradientPolish = config.gradientPolish;
+        restored.maxRestarts = config.maxRestarts;
+        restored.restartPopulationGrowth = config.restartPopulationGrowth;
+        restored.concurrentRestarts = config.concurrentRestarts;
+        restored.maxEvaluations = config.maxEvaluations;
+        restored.timeLimitSeconds = config.timeLimitSeconds;
+        config = restored;
+        
+        // Rate control continues from the run's own baseline with its own controller
+        configuredMutationRate = data.initialMutationRate;
+        configuredCrossoverRate = data.initialCrossoverRate;
+        rateController = createRateController(config);
+        
+        // Adaptive refinement may have narrowed config; keep the run's original domain for polish and run()
+        configuredMinValue = data.initialMinValue;
+        configuredMaxValue = data.initialMaxValue;
+        configuredChromosomeLength = data.initialChromosomeLength;
+        refinementCount = data.refinementCount;
+        
+        std::ostringstream rngText;
+        for (size_t i = 0; i < data.rngState.size(); ++i) {
+            rngText << (i == 0 ? "" : " ") << data.rngState[i];
+        }
+        std::istringstream rngStream(rngText.str());
+        rngStream >> rng;
+        if (rngStream.fail()) {
+            throw std::runtime_error("Checkpoint contains an invalid random number generator state");
+        }
+        
+        population.clear();
+        populationIndexValid = false;
+        populationSummaryValid = false;
+        population.reserve(data.populationSize());
+        for (size_t i = 0; i < data.populationSize(); ++i) {
+            Individual individual;
+            individual.unpackChromosome(&data.packedChromosomes[i * data.wordsPerIndividual], data.chromosomeLength);
+            if (data.fitnessValid[i]) {
+                individual.setFitness(data.fitness[i]);
+                individual.setFitnessPercentage(data.fitnessPercentage[i]);
+            }
+            if (!data.selfAdaptiveRates.empty()) {
+                individual.setSelfAdaptiveRate(data.selfAdaptiveRates[i]);
+            }
+            population.push_back(individual);
+        }
+        
+        statisticsSink->restore(data.statistics);
+        currentGeneration = data.generation;
+        
+        evaluationCount = data.evaluationCount;
+        runStartTime = std::chrono::steady_clock::now() -
+                       std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                           std::chrono::duration<double>(data.elapsedSeconds));
+        hasBestSoFar = data.hasBestSoFar;
+        if (hasBestSoFar) {
+            bestSoFar.unpackChromosome(data.bestSoFarChromosome.data(), data.bestSoFarLength);
+            bestSoFar.setFitness(data.bestSoFarFitness);
+        }
+    }
+    
+    // Write a checkpoint synchronously
+    void GeneticAlgorithm::saveCheckpoint(const std::string& path) const {
+        CheckpointData data;
+        captureCheckpoint(data);
+        Checkpoint::save(data, path);
+    }
+    
+    // Write a columnar population snapshot
+    void GeneticAlgorithm::savePopulationSnapshot(const std::string& path) const {
+        PopulationSnapshot::write(path, population, config, currentGeneration);
+    }
+    
+    // Hand a snapshot to the background writer
+    void GeneticAlgorithm::writeCheckpoint() {
+        if (!checkpointWriter || checkpointWriter->getPath() != config.checkpointPath) {
+            checkpointWriter.reset();
+            checkpointWriter = std::make_unique<CheckpointWriter>(config.checkpointPath);
+        }
+        
+        captureCheckpoint(checkpointWriter->backBuffer());
+        checkpointWriter->submit();
     }
     
     // Getters
@@ -551,8 +1650,32 @@ namespace GA {
         return config;
     }
     
+    int GeneticAlgorithm::getRefinementCount() const {
+        return refinementCount;
+    }
+    
     const std::vector<GenerationStats>& GeneticAlgorithm::getStatistics() const {
-        return statistics;
+        return statisticsSink->getRetained();
+    }
+    
+    StatisticsSink& GeneticAlgorithm::getStatisticsSink() const {
+        return *statisticsSink;
+    }
+    
+    uint64_t GeneticAlgorithm::getEvaluationCount() const {
+        return evaluationCount;
+    }
+    
+    const std::string& GeneticAlgorithm::getTerminationReason() const {
+        return terminationReason;
+    }
+    
+    const GAProfile& GeneticAlgorithm::getProfile() const {
+        return profile;
+    }
+    
+    EventTracer& GeneticAlgorithm::getEventTracer() {
+        return tracer;
     }
     
     int GeneticAlgorithm::getCurrentGeneration() const {
@@ -563,7 +1686,22 @@ namespace GA {
         return *fitnessFunction;
     }
     
+    StoppingCriterion& GeneticAlgorithm::getStoppingCriterion() const {
+        return *stoppingCriterion;
+    }
+    
     // Setters
+    void GeneticAlgorithm::setStoppingCriterion(std::unique_ptr<StoppingCriterion> criterion) {
+        if (!criterion) {
+            throw std::invalid_argument("Stopping criterion cannot be null");
+        }
+        stoppingCriterion = std::move(criterion);
+    }
+    
+    void GeneticAlgorithm::setRateController(std::unique_ptr<RateController> controller) {
+        rateController = std::move(controller);
+    }
+    
     void GeneticAlgorithm::setFitnessFunction(std::unique_ptr<FitnessFunction> newFitnessFunction) {
         if (!newFitnessFunction) {
             throw std::invalid_argument("Fitness function cannot be null");
@@ -571,17 +1709,37 @@ namespace GA {
         fitnessFunction = std::move(newFitnessFunction);
         
         // Invalidate all fitness values in current population
+        populationIndexValid = false;
+        populationSummaryValid = false;
         for (Individual& individual : population) {
             individual.invalidateFitness();
         }
     }
     
+    void GeneticAlgorithm::setStatisticsSink(std::unique_ptr<StatisticsSink> newSink) {
+        if (!newSink) {
+            throw std::invalid_argument("Statistics sink cannot be null");
+        }
+        statisticsSink = std::move(newSink);
+    }
+    
     void GeneticAlgorithm::updateConfig(const GAConfig& newConfig) {
+        if (newConfig.randomSeed != 0 && newConfig.randomSeed != config.randomSeed) {
+            rng.seed(newConfig.randomSeed);
+        }
         config = newConfig;
+        configuredMinValue = config.minValue;
+        configuredMaxValue = config.maxValue;
+        configuredChromosomeLength = config.chromosomeLength;
+        configuredMutationRate = config.mutationRate;
+        configuredCrossoverRate = config.crossoverRate;
+        rateController = createRateController(config);
         
-        // If population size changed, we may need to reinitialize
+        // A new population size takes effect when the population is re-initialized
+        // (in place, so the existing individuals keep their buffers)
         if (population.size() != static_cast<size_t>(config.populationSize)) {
-            reset();
+            populationIndexValid = false;
+            populationSummaryValid = false;
         }
     }
 }
\ No newline at end of file
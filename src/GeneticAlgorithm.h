@@ -4,10 +4,23 @@
 #include "GeneticTypes.h"
 #include "Individual.h"
 #include "FitnessFunction.h"
+#include "Checkpoint.h"
+#include "StatisticsSink.h"
+#include "Profiler.h"
+#include "EventTracer.h"
+#include "ThreadPool.h"
+#include "StoppingCriteria.h"
+#include "PopulationIndex.h"
+#include "AsyncEvaluator.h"
+#include "PopulationSummary.h"
+#include "LocalSearch.h"
+#include "RateControl.h"
+#include "Niching.h"
 #include <vector>
 #include <random>
 #include <memory>
 #include <functional>
+#include <chrono>
 
 namespace GA {
     /**
@@ -24,13 +37,213 @@ namespace GA {
         Population population;                     // Current population
         std::unique_ptr<FitnessFunction> fitnessFunction;  // Fitness evaluation function
         std::mt19937 rng;                         // Random number generator
-        std::vector<GenerationStats> statistics;  // Statistics for each generation
+        std::unique_ptr<StatisticsSink> statisticsSink;  // Destination and retention of generation statistics
         int currentGeneration;                    // Current generation number
         
         // Progress callback function type
         using ProgressCallback = std::function<void(int, const GenerationStats&)>;
         ProgressCallback progressCallback;
         
+        std::unique_ptr<CheckpointWriter> checkpointWriter;  // Background checkpoint writer
+        GAProfile profile;                        // Per-phase timings and counters of the current run
+        EventTracer tracer;                       // Timeline of phases and evaluation chunks
+        std::unique_ptr<ThreadPool> evaluationPool;  // Workers for parallel fitness evaluation and breeding
+        std::unique_ptr<HardwareCounters> hardwareCounters;  // Counters of the thread running the loop (optional)
+        
+        std::unique_ptr<StoppingCriterion> stoppingCriterion;  // Early-termination policy
+        std::string terminationReason;            // Why the last run stopped
+        uint64_t evaluationCount;                 // Fitness evaluations of the current run (cache hits excluded)
+        std::chrono::steady_clock::time_point runStartTime;  // Wall-clock start of the current run
+        bool budgetExhausted;                     // Set when maxEvaluations or the deadline is hit
+        Individual bestSoFar;                     // Best individual evaluated during the run
+        bool hasBestSoFar;                        // Whether bestSoFar holds an individual
+        RunSummary runSummary;                    // Accounting of the last completed run
+        
+        PopulationIndex populationIndex;          // Fitness order and running sums (steady-state mode)
+        bool populationIndexValid;                // Whether populationIndex matches the population
+        std::unique_ptr<AsyncEvaluator> asyncEvaluator;  // Barrier-free evaluation workers (asynchronous mode)
+        PopulationSummary populationSummary;      // Aggregates of the last fused statistics pass
+        bool populationSummaryValid;              // Whether populationSummary matches the population
+        
+        double configuredMinValue;                // Domain run() starts from (adaptive refinement changes config)
+        double configuredMaxValue;
+        int configuredChromosomeLength;           // Chromosome length run() starts from
+        int refinementCount;                      // Domain refinements in the current run
+        
+        std::unique_ptr<RateController> rateController;  // Adjusts the operator rates between generations (nullptr = constant)
+        double configuredMutationRate;            // Rates run() starts from (rate control changes config)
+        double configuredCrossoverRate;
+        uint64_t offspringBred;                   // Offspring of the current generation (success-based rate control)
+        uint64_t offspringImproved;               // ... of which beat their better parent
+        
+        Niching niching;                          // Sharing / clearing scratch buffers
+        std::vector<double> nicheFitness;         // Niche-adjusted goodness per slot (empty = raw fitness)
+        std::vector<size_t> nicheRanking;         // Slots by descending niche fitness (built with nicheFitness)
+        
+        /**
+         * @brief Runs generations from currentGeneration + 1 until termination
+         * @return Statistics of the final generation
+         */
+        GenerationStats runEvolutionLoop();
+        
+        /**
+         * @brief Hands a snapshot of the current state to the background writer
+         */
+        void writeCheckpoint();
+        
+        /**
+         * @brief Resets the profile and starts tracing and hardware counters as configured
+         */
+        void beginInstrumentation();
+        
+        /**
+         * @brief Checks the evaluation budget and deadline and records why the run must stop
+         * @return True if a compute limit has been reached
+         */
+        bool checkComputeBudget();
+        
+        /**
+         * @brief Fills the run summary at the end of a run
+         */
+        void finishRun();
+        
+        /**
+         * @brief Consults the stopping criterion after a generation
+         * @param stats Statistics of the generation just completed
+         * @return True if the run should stop
+         */
+        bool checkStoppingCriterion(const GenerationStats& stats);
+        
+        /**
+         * @brief Selects two parents and produces two mutated offspring
+         * @param eliteCount Number of top individuals ELITISM selection draws from
+         * @return Pair of offspring (not yet evaluated)
+         */
+        std::pair<Individual, Individual> breedOffspring(int eliteCount);
+        
+        /**
+         * @brief Fills newPopulation up to populationSize in breedingChunkSize chunks
+         * @param newPopulation Next generation holding the elites so far
+         * @param eliteCount Number of top individuals ELITISM selection draws from
+         *
+         * Each chunk uses its own generator seeded from one draw of the shared
+         * generator and the chunk index, so the result is the same for any
+         * number of threads.
+         */
+        void breedChunks(Population& newPopulation, int eliteCount);
+        
+        /**
+         * @brief Selects two parents with the configured strategy
+         * @param eliteCount Number of top individuals ELITISM selection draws from
+         * @param generator Random source
+         * @return Pair of parents
+         */
+        std::pair<Individual, Individual> selectParents(int eliteCount, std::mt19937& generator);
+        
+        /**
+         * @brief Applies crossover with probability crossoverRate (copies the parents otherwise)
+         * @param parent1 First parent
+         * @param parent2 Second parent
+         * @param generator Random source
+         * @return Pair of offspring (not yet mutated)
+         */
+        std::pair<Individual, Individual> recombine(const Individual& parent1, const Individual& parent2,
+                                                    std::mt19937& generator);
+        
+        /**
+         * @brief Gets the worker pool shared by evaluation and breeding
+         * @return Pool sized by evaluationThreads, or nullptr when evaluationThreads is 1
+         */
+        ThreadPool* getWorkerPool();
+        
+        // Generator-parameter forms of the operators (read-only on the engine, safe to call concurrently)
+        Individual tournamentSelection(int tournamentSize, std::mt19937& generator) const;
+        Individual rouletteWheelSelection(std::mt19937& generator) const;
+        
+        /**
+         * @brief Compares two slots for selection
+         * @param a First slot
+         * @param b Second slot
+         * @return True if a is strictly better (niche fitness while niching, raw fitness otherwise)
+         */
+        bool selectionBetter(size_t a, size_t b) const;
+        std::pair<Individual, Individual> performCrossover(const Individual& parent1, const Individual& parent2,
+                                                           std::mt19937& generator) const;
+        void performMutation(Individual& individual, std::mt19937& generator) const;
+        
+        /**
+         * @brief Zooms the domain in on the best individual once the population has concentrated
+         * @return True if the domain was refined (the population is then re-encoded and re-evaluated)
+         *
+         * The next window is refinementShrink times the current width and
+         * refinementBits longer, aligned so the best individual stays a grid
+         * point. It is taken only if refinementConcentration of the population
+         * decodes inside it; individuals outside are replaced by random ones.
+         */
+        bool refineDomain();
+        
+        /**
+         * @brief Polishes the localSearchElites best individuals with the configured local optimizer
+         *
+         * Each individual gets localSearchEvaluations evaluations (split from the
+         * remaining maxEvaluations when that is smaller); individuals are
+         * polished in parallel on the evaluation workers.
+         */
+        void applyLocalSearch();
+        
+        /**
+         * @brief Computes the niche fitness and ranking of the current population (config.niching)
+         */
+        void updateNicheFitness();
+        
+        /**
+         * @brief Performs one generational step (elites plus bred offspring replace the population)
+         * @return Statistics for the current generation
+         */
+        GenerationStats evolveGenerational();
+        
+        /**
+         * @brief Counts an evaluated offspring towards the generation's success ratio
+         * @param child Evaluated offspring carrying its parent fitness
+         */
+        void recordOffspringSuccess(const Individual& child);
+        
+        /**
+         * @brief Asks the rate controller for the next generation's rates and stores them in config
+         * @param stats Statistics of the generation just completed
+         */
+        void updateOperatorRates(const GenerationStats& stats);
+        
+        /**
+         * @brief Performs one steady-state generation (populationSize offspring, k at a time)
+         * @return Statistics for the current generation
+         */
+        GenerationStats evolveSteadyState();
+        
+        /**
+         * @brief Performs one asynchronous generation (populationSize results taken back from the workers)
+         * @return Statistics for the current generation
+         */
+        GenerationStats evolveAsynchronous();
+        
+        /**
+         * @brief Inserts an evaluated offspring into the indexed population
+         * @param child Evaluated offspring
+         */
+        void insertOffspring(const Individual& child);
+        
+        /**
+         * @brief Picks the slot a steady-state offspring overwrites (never the current best)
+         * @return Population slot
+         */
+        size_t selectReplacementSlot();
+        
+        /**
+         * @brief Builds generation statistics from the population index in O(L)
+         * @return GenerationStats object with current statistics
+         */
+        GenerationStats calculateSteadyStateStats();
+        
     public:
         // Constructors
         GeneticAlgorithm(const GAConfig& config, std::unique_ptr<FitnessFunction> fitnessFunc);
@@ -52,20 +265,85 @@ namespace GA {
          */
         GenerationStats run(ProgressCallback callback);
         
+        /**
+         * @brief Restores a checkpoint and continues the run bit-exactly
+         * @param path Checkpoint file written by a previous run
+         * @param callback Function called after each generation (optional)
+         * @return Statistics of the final generation
+         *
+         * Evaluations and run time already spent count against maxEvaluations
+         * and timeLimitSeconds; a checkpoint taken when the budget ran out
+         * finishes immediately. Set the same stopping criterion as the original
+         * run before resuming: its saved state (e.g. stagnation progress) is
+         * restored into it.
+         */
+        GenerationStats resume(const std::string& path, ProgressCallback callback = nullptr);
+        
+        // Checkpointing
+        /**
+         * @brief Captures the complete resumable state into a snapshot
+         * @param data Snapshot to fill (existing buffers are reused)
+         */
+        void captureCheckpoint(CheckpointData& data) const;
+        
+        /**
+         * @brief Restores the complete state from a snapshot
+         * @param data Snapshot produced by captureCheckpoint or Checkpoint::load
+         */
+        void restoreCheckpoint(const CheckpointData& data);
+        
+        /**
+         * @brief Writes a checkpoint of the current state synchronously
+         * @param path Destination file path
+         */
+        void saveCheckpoint(const std::string& path) const;
+        
+        /**
+         * @brief Writes the current population as a memory-mappable snapshot
+         * @param path Destination file path (read back with PopulationSnapshotReader)
+         */
+        void savePopulationSnapshot(const std::string& path) const;
+        
         // Population management
         /**
          * @brief Initializes the population with random individuals
+         *
+         * Individuals from a previous run are re-randomized in place.
          */
         void initializePopulation();
         
         /**
          * @brief Evaluates fitness for all individuals in the population
+         *
+         * With config.evaluationThreads != 1 the population is split into chunks
+         * evaluated concurrently, so the fitness function must be thread-safe.
+         * When config.maxEvaluations or config.timeLimitSeconds is reached part
+         * way through, individuals left unevaluated are removed. Functions that
+         * support asynchronous evaluation have all pending evaluations started
+         * on one EvaluationLoop and awaited together.
          */
         void evaluatePopulation();
         
         /**
          * @brief Performs one generation of the genetic algorithm
          * @return Statistics for the current generation
+         *
+         * In STEADY_STATE mode a generation is populationSize offspring produced
+         * config.steadyStateOffspring at a time; each is evaluated and inserted
+         * at once, so it can be selected as a parent by the next step.
+         * ASYNCHRONOUS mode keeps about two candidates per worker in flight
+         * (config.evaluationThreads workers) and inserts results in completion
+         * order; evaluations still running at a generation boundary carry over.
+         * Its trajectory depends on thread timing unless one worker is used.
+         * In GENERATIONAL mode a positive config.breedingChunkSize breeds the
+         * offspring in chunks on the evaluation workers. With
+         * config.adaptiveRefinement the generation may first zoom the domain in
+         * (see refineDomain), which changes config.minValue, config.maxValue and
+         * config.chromosomeLength. Every config.localSearchInterval generations
+         * the best individuals are polished first (see applyLocalSearch).
+         * Afterwards the rate controller (config.rateControl or
+         * setRateController) sets config.mutationRate and config.crossoverRate
+         * for the next generation.
          */
         GenerationStats evolveGeneration();
         
@@ -87,6 +365,9 @@ namespace GA {
          * @brief Selects elite individuals from population
          * @param eliteCount Number of elite individuals to select
          * @return Vector of elite individuals
+         *
+         * While niche fitness is set the elites are the best by niche fitness
+         * (one per niche under clearing) and the population is not re-sorted.
          */
         std::vector<Individual> eliteSelection(int eliteCount);
         
@@ -119,6 +400,40 @@ namespace GA {
          */
         Individual getBestIndividual() const;
         
+        /**
+         * @brief Gets the best individual evaluated during the current run
+         * @return Best-so-far individual (may have left the population, e.g. after a budget cut)
+         */
+        Individual getBestSoFar() const;
+        
+        /**
+         * @brief Refines the best-so-far solution with Newton's method on the function's derivatives
+         * @param maxIterations Newton iterations allowed
+         * @return Polished value and fitness (available is false if the function has no derivatives)
+         *
+         * The decoded value is limited to the chromosome grid; the polished
+         * value is not. Runs automatically at the end of run() when
+         * gradientPolish is set (see RunSummary::polished).
+         */
+        PolishedSolution polishBestSolution(int maxIterations = 50) const;
+        
+        /**
+         * @brief Gets the best individual of every niche of the current population
+         * @param radius Niche radius in decoded units (0 = config.nicheRadius)
+         * @return Niche winners, best first
+         *
+         * Clearing with capacity 1 over the population sorted by decoded
+         * value (O(N log N)); with niching enabled the population holds
+         * several optima and this returns all of them from one run.
+         */
+        std::vector<Individual> getNichePeaks(double radius = 0.0) const;
+        
+        /**
+         * @brief Gets the budget accounting of the last run
+         * @return Generations, evaluations, wall time, evaluations per second and termination reason
+         */
+        const RunSummary& getRunSummary() const;
+        
         /**
          * @brief Gets the worst individual from current population
          * @return The individual with worst fitness
@@ -128,6 +443,9 @@ namespace GA {
         /**
          * @brief Calculates population diversity (convergence measure)
          * @return Diversity value (0 = fully converged, 1 = maximum diversity)
+         *
+         * Mean pairwise Hamming distance per bit, computed in O(N·L) from
+         * per-bit one counts instead of comparing every pair.
          */
         double calculatePopulationDiversity() const;
         
@@ -145,11 +463,47 @@ namespace GA {
         const GAConfig& getConfig() const;
         
         /**
-         * @brief Gets all generation statistics
-         * @return Vector of generation statistics
+         * @brief Gets the number of adaptive domain refinements in the current run
+         * @return Refinement count
+         */
+        int getRefinementCount() const;
+        
+        /**
+         * @brief Gets the generation statistics retained by the statistics sink
+         * @return Vector of generation statistics (first entry followed by retained recent entries)
          */
         const std::vector<GenerationStats>& getStatistics() const;
         
+        /**
+         * @brief Gets the statistics sink
+         * @return Reference to the statistics sink
+         */
+        StatisticsSink& getStatisticsSink() const;
+        
+        /**
+         * @brief Gets the per-phase timings and counters of the last run
+         * @return Profile (empty when built with GA_DISABLE_PROFILING)
+         */
+        const GAProfile& getProfile() const;
+        
+        /**
+         * @brief Gets the event tracer (started automatically when config.traceOutputPath is set)
+         * @return Reference to the event tracer
+         */
+        EventTracer& getEventTracer();
+        
+        /**
+         * @brief Gets the number of fitness evaluations of the current run
+         * @return Evaluations so far (individuals whose fitness was still valid are not counted)
+         */
+        uint64_t getEvaluationCount() const;
+        
+        /**
+         * @brief Gets why the last run stopped
+         * @return Description of the criterion that fired, or the generation limit
+         */
+        const std::string& getTerminationReason() const;
+        
         /**
          * @brief Gets the current generation number
          * @return Current generation number
@@ -186,9 +540,40 @@ namespace GA {
          */
         void setFitnessFunction(std::unique_ptr<FitnessFunction> newFitnessFunction);
         
+        /**
+         * @brief Sets the early-termination policy (default: diversity below 0.01)
+         * @param criterion Criterion or AND/OR combination consulted after each generation
+         */
+        void setStoppingCriterion(std::unique_ptr<StoppingCriterion> criterion);
+        
+        /**
+         * @brief Sets the policy that adjusts the operator rates between generations
+         * @param controller Controller consulted after each generation (nullptr = constant rates)
+         *
+         * The constructor, updateConfig and resume install the built-in controller of config.rateControl.
+         */
+        void setRateController(std::unique_ptr<RateController> controller);
+        
+        /**
+         * @brief Gets the early-termination policy
+         * @return Reference to the stopping criterion
+         */
+        StoppingCriterion& getStoppingCriterion() const;
+        
+        /**
+         * @brief Sets where generation statistics go and how much history is retained
+         * @param newSink New statistics sink (in-memory, ring buffer or file based)
+         */
+        void setStatisticsSink(std::unique_ptr<StatisticsSink> newSink);
+        
         /**
          * @brief Updates algorithm configuration
          * @param newConfig New configuration to use
+         *
+         * The new domain, chromosome length and rates become the ones run()
+         * starts from; a new nonzero randomSeed reseeds the generator. A new
+         * population size takes effect at the next run() or
+         * initializePopulation(), which reuse the existing individuals.
          */
         void updateConfig(const GAConfig& newConfig);
     };
@@ -4,6 +4,7 @@
 #include <vector>
 #include <string>
 #include <functional>
+#include <cstdint>
 
 namespace GA {
     // Type definitions for genetic algorithm components
@@ -25,6 +26,43 @@ namespace GA {
         UNIFORM
     };
     
+    // Enumeration for how offspring enter the population
+    enum class EvolutionMode {
+        GENERATIONAL,               // Whole population replaced every generation
+        STEADY_STATE,               // A few offspring at a time replace existing individuals
+        ASYNCHRONOUS                // Steady state with evaluations running on workers while breeding continues
+    };
+    
+    // Enumeration for steady-state replacement strategies
+    enum class ReplacementStrategy {
+        WORST,                      // Offspring replace the current worst individual
+        TOURNAMENT                  // Offspring replace the loser of an inverse tournament
+    };
+    
+    // Enumeration for memetic local search strategies
+    enum class LocalSearchType {
+        NONE,                       // No local search
+        HILL_CLIMB,                 // Bit-flip hill climbing on the chromosome
+        BRENT                       // Brent's method (golden section + parabolic steps) on the decoded value
+    };
+    
+    // Enumeration for operator rate control
+    enum class RateControlType {
+        CONSTANT,                   // mutationRate and crossoverRate stay fixed
+        LINEAR_SCHEDULE,            // Both rates move linearly to their final values over maxGenerations
+        EXPONENTIAL_SCHEDULE,       // Both rates move geometrically to their final values over maxGenerations
+        DIVERSITY_FEEDBACK,         // Mutation rate rises below targetDiversity and falls above it
+        ONE_FIFTH_SUCCESS,          // Mutation rate rises while more than 1/5 of offspring beat their parents
+        SELF_ADAPTIVE               // Each individual carries and mutates its own mutation rate
+    };
+    
+    // Enumeration for niching (several optima kept in one population)
+    enum class NichingType {
+        NONE,                       // Selection sees the raw fitness
+        FITNESS_SHARING,            // Fitness divided by the niche count within nicheRadius
+        CLEARING                    // Only the nicheCapacity best of each niche keep their fitness
+    };
+    
     // Configuration structure for genetic algorithm parameters
     struct GAConfig {
         int populationSize = 50;        // Number of individuals in population
@@ -38,9 +76,66 @@ namespace GA {
         CrossoverType crossoverType = CrossoverType::SINGLE_POINT;
         int tournamentSize = 3;         // Size of tournament for tournament selection
         
+        // Steady-state parameters (used when evolutionMode is STEADY_STATE or ASYNCHRONOUS)
+        EvolutionMode evolutionMode = EvolutionMode::GENERATIONAL;
+        int steadyStateOffspring = 2;   // Offspring produced, evaluated and inserted per step
+        ReplacementStrategy replacementStrategy = ReplacementStrategy::WORST;
+        
+        // Memetic local search parameters
+        LocalSearchType localSearch = LocalSearchType::NONE;
+        int localSearchInterval = 10;   // Generations between local search steps
+        int localSearchElites = 2;      // Best individuals polished per step
+        int localSearchEvaluations = 64; // Evaluation budget per polished individual
+        bool gradientPolish = false;    // Newton-polish the best solution when the run ends (functions with derivatives)
+        
+        // Operator rate control (mutationRate and crossoverRate are the starting rates)
+        RateControlType rateControl = RateControlType::CONSTANT;
+        double finalMutationRate = 0.001; // Mutation rate reached at maxGenerations (schedules)
+        double finalCrossoverRate = 0.6; // Crossover rate reached at maxGenerations (schedules)
+        double targetDiversity = 0.2;   // Convergence value the diversity feedback steers towards
+        double rateAdaptationFactor = 1.2; // Per-generation mutation rate multiplier (feedback and 1/5th rule)
+        double minMutationRate = 0.0005; // Lower bound of adapted mutation rates
+        double maxMutationRate = 0.25;  // Upper bound of adapted mutation rates
+        
+        // Niching parameters (GENERATIONAL mode)
+        NichingType niching = NichingType::NONE;
+        double nicheRadius = 0.5;       // Decoded-value distance within which individuals share a niche
+        double sharingAlpha = 1.0;      // Shape of the sharing function 1 - (d / nicheRadius)^alpha
+        int nicheCapacity = 1;          // Individuals per niche that keep their fitness (clearing)
+        
+        // Restart parameters (RestartDriver)
+        int maxRestarts = 4;            // Restarts after the first run
+        double restartPopulationGrowth = 2.0; // Population multiplier per restart (IPOP)
+        int concurrentRestarts = 1;     // Restarts run side by side on separate engines (0 = all cores)
+        
+        // Multi-objective parameters (MultiObjectiveGA)
+        int paretoArchiveSize = 100;    // Non-dominated solutions kept across generations (most crowded dropped first)
+        
         // Function domain parameters
         double minValue = -10.0;        // Minimum value of the function domain
         double maxValue = 10.0;         // Maximum value of the function domain
+        
+        // Adaptive domain refinement parameters (domain and chromosome length change during the run)
+        bool adaptiveRefinement = false; // Zoom the domain in on the best individual as the population concentrates
+        double refinementConcentration = 0.8; // Fraction of the population inside the next window that triggers a zoom
+        double refinementShrink = 0.25; // Width of the next window relative to the current domain
+        int refinementBits = 2;         // Bits added to the chromosome per zoom (at most 53 in total)
+        double targetPrecision = 0.0;   // Decoding step at which zooming stops (0 = until the 53-bit limit)
+        
+        // Reproducibility and persistence parameters
+        unsigned int randomSeed = 0;    // Seed for the random number generator (0 = random device)
+        int checkpointInterval = 0;     // Generations between checkpoints (0 = disabled)
+        std::string checkpointPath = "ga_checkpoint.bin"; // File used for periodic checkpoints
+        
+        // Execution and diagnostics parameters
+        int evaluationThreads = 1;      // Threads evaluating fitness (1 = calling thread only, 0 = all cores)
+        int breedingChunkSize = 0;      // Offspring per parallel breeding chunk (0 = serial breeding, generational mode)
+        std::string traceOutputPath;    // Chrome trace JSON written at the end of a run (empty = tracing off)
+        bool collectHardwareCounters = false; // Sample perf_event counters around each phase (Linux only)
+        
+        // Compute budget parameters (enforced mid-generation)
+        uint64_t maxEvaluations = 0;    // Fitness evaluations allowed per run (0 = unlimited)
+        double timeLimitSeconds = 0.0;  // Wall-clock deadline per run in seconds (0 = unlimited)
     };
     
     // Statistics structure to track algorithm performance
@@ -54,6 +149,28 @@ namespace GA {
         double bestFitnessPercentage;   // Best fitness as percentage
         double averageFitnessPercentage; // Average fitness as percentage
     };
+    
+    // Result of polishing a decoded value with Newton's method
+    struct PolishedSolution {
+        bool available = false;         // False if the function provides no derivatives
+        double value = 0.0;             // Polished x (not restricted to the chromosome grid)
+        FitnessValue fitness = 0.0;     // Fitness at value
+        double derivative = 0.0;        // f'(value)
+        int iterations = 0;             // Newton iterations taken
+        uint64_t evaluations = 0;       // Dual-number evaluations used
+        bool converged = false;         // True if the step fell to rounding level or f' reached zero
+    };
+    
+    // Summary of a complete run (budget accounting)
+    struct RunSummary {
+        int generations = 0;            // Generations completed
+        uint64_t evaluations = 0;       // Fitness evaluations (cache hits excluded)
+        double wallSeconds = 0.0;       // Wall time of the run
+        double evaluationsPerSecond = 0.0; // Evaluation throughput
+        bool budgetExhausted = false;   // True if maxEvaluations or the deadline ended the run
+        std::string terminationReason;  // Why the run stopped
+        PolishedSolution polished;      // Newton polish of the best solution (when gradientPolish is set)
+    };
 }
 
 #endif // GENETIC_TYPES_H
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include "HardwareCounters.h"
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#ifdef __linux__
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace GA {
+
+    const char* hardwareEventName(HardwareEvent event) {
+        switch (event) {
+            case HardwareEvent::CYCLES: return "Cycles";
+            case HardwareEvent::INSTRUCTIONS: return "Instructions";
+            case HardwareEvent::CACHE_MISSES: return "Cache misses";
+            case HardwareEvent::BRANCH_MISSES: return "Branch misses";
+            case HardwareEvent::DTLB_MISSES: return "dTLB misses";
+            default: return "Unknown";
+        }
+    }
+
+    double HardwareCounterValues::instructionsPerCycle() const {
+        uint64_t cycles = get(HardwareEvent::CYCLES);
+        return (cycles > 0) ? static_cast<double>(get(HardwareEvent::INSTRUCTIONS)) / cycles : 0.0;
+    }
+
+    HardwareCounterValues HardwareCounterValues::operator-(const HardwareCounterValues& other) const {
+        HardwareCounterValues difference;
+        for (size_t i = 0; i < EVENT_COUNT; ++i) {
+            difference.values[i] = (values[i] >= other.values[i]) ? values[i] - other.values[i] : 0;
+        }
+        return difference;
+    }
+
+    HardwareCounterValues& HardwareCounterValues::operator+=(const HardwareCounterValues& other) {
+        for (size_t i = 0; i < EVENT_COUNT; ++i) {
+            values[i] += other.values[i];
+        }
+        return *this;
+    }
+
+#ifdef __linux__
+    namespace {
+        // perf_event_attr type/config for each HardwareEvent
+        void describeEvent(HardwareEvent event, perf_event_attr& attr) {
+            switch (event) {
+                case HardwareEvent::CYCLES:
+                    attr.type = PERF_TYPE_HARDWARE;
+                    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+                    break;
+                case HardwareEvent::INSTRUCTIONS:
+                    attr.type = PERF_TYPE_HARDWARE;
+                    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+                    break;
+                case HardwareEvent::CACHE_MISSES:
+                    attr.type = PERF_TYPE_HARDWARE;
+                    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+                    break;
+                case HardwareEvent::BRANCH_MISSES:
+                    attr.type = PERF_TYPE_HARDWARE;
+                    attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+                    break;
+                default:
+                    attr.type = PERF_TYPE_HW_CACHE;
+                    attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                    break;
+            }
+        }
+
+        int openEvent(HardwareEvent event, int groupLeader) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            describeEvent(event, attr);
+            attr.disabled = (groupLeader < 0) ? 1 : 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupLeader, 0));
+        }
+    }
+
+    // Open every supported event into one group led by the first that opens
+    HardwareCounters::HardwareCounters() : leaderDescriptor(-1), openedCount(0) {
+        descriptors.fill(-1);
+        opened.fill(false);
+
+        int firstError = 0;
+        for (size_t i = 0; i < HardwareCounterValues::EVENT_COUNT; ++i) {
+            int descriptor = openEvent(static_cast<HardwareEvent>(i), leaderDescriptor);
+            if (descriptor < 0) {
+                if (firstError == 0) {
+                    firstError = errno;
+                }
+                continue;
+            }
+            if (leaderDescriptor < 0) {
+                leaderDescriptor = descriptor;
+            }
+            descriptors[i] = descriptor;
+            opened[i] = true;
+            openedCount++;
+        }
+
+        if (leaderDescriptor < 0) {
+            unavailableReason = std::string("perf_event_open failed: ") + std::strerror(firstError);
+            return;
+        }
+
+        ioctl(leaderDescriptor, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leaderDescriptor, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    HardwareCounters::~HardwareCounters() {
+        for (int descriptor : descriptors) {
+            if (descriptor >= 0) {
+                close(descriptor);
+            }
+        }
+    }
+
+    // Read the whole group in one syscall and scale for multiplexing
+    HardwareCounterValues HardwareCounters::read() const {
+        HardwareCounterValues result;
+        if (leaderDescriptor < 0) {
+            return result;
+        }
+
+        // Layout: nr, time_enabled, time_running, value[nr]
+        std::vector<uint64_t> buffer(3 + openedCount);
+        ssize_t bytes = ::read(leaderDescriptor, buffer.data(), buffer.size() * sizeof(uint64_t));
+        if (bytes < static_cast<ssize_t>(3 * sizeof(uint64_t))) {
+            return result;
+        }
+
+        uint64_t count = buffer[0];
+        uint64_t timeEnabled = buffer[1];
+        uint64_t timeRunning = buffer[2];
+        double scale = (timeRunning > 0 && timeRunning < timeEnabled)
+                           ? static_cast<double>(timeEnabled) / timeRunning : 1.0;
+
+        // Group values are returned in the order the events were opened
+        size_t slot = 0;
+        for (size_t i = 0; i < HardwareCounterValues::EVENT_COUNT && slot < count; ++i) {
+            if (opened[i]) {
+                result.values[i] = static_cast<uint64_t>(buffer[3 + slot] * scale);
+                slot++;
+            }
+        }
+        return result;
+    }
+#else
+    HardwareCounters::HardwareCounters() : leaderDescriptor(-1), openedCount(0) {
+        descriptors.fill(-1);
+        opened.fill(false);
+        unavailableReason = "Hardware counters require Linux perf_event";
+    }
+
+    HardwareCounters::~HardwareCounters() {
+    }
+
+    HardwareCounterValues HardwareCounters::read() const {
+        return HardwareCounterValues();
+    }
+#endif
+
+    bool HardwareCounters::isAvailable() const {
+        return leaderDescriptor >= 0;
+    }
+
+    bool HardwareCounters::isCounting(HardwareEvent event) const {
+        return opened[static_cast<size_t>(event)];
+    }
+
+    const std::string& HardwareCounters::getUnavailableReason() const {
+        return unavailableReason;
+    }
+}
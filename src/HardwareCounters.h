@@ -0,0 +1,110 @@
+#ifndef HARDWARE_COUNTERS_H
+#define HARDWARE_COUNTERS_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+/**
+ * @file HardwareCounters.h
+ * @brief CPU performance counters through Linux perf_event_open
+ *
+ * Counters measure the calling thread in user space only. On other platforms,
+ * or when the kernel refuses access (perf_event_paranoid, containers, VMs
+ * without a virtual PMU), isAvailable() is false and every read returns zeros.
+ */
+
+namespace GA {
+    /**
+     * @brief Hardware events sampled as one counter group
+     */
+    enum class HardwareEvent {
+        CYCLES,
+        INSTRUCTIONS,
+        CACHE_MISSES,
+        BRANCH_MISSES,
+        DTLB_MISSES,
+        COUNT
+    };
+
+    /**
+     * @brief Gets a printable event name
+     * @param event The event
+     * @return Event name
+     */
+    const char* hardwareEventName(HardwareEvent event);
+
+    /**
+     * @struct HardwareCounterValues
+     * @brief Counter readings (absolute or a difference between two readings)
+     */
+    struct HardwareCounterValues {
+        static const size_t EVENT_COUNT = static_cast<size_t>(HardwareEvent::COUNT);
+
+        std::array<uint64_t, EVENT_COUNT> values{};  // Count per event (0 when unavailable)
+
+        uint64_t get(HardwareEvent event) const { return values[static_cast<size_t>(event)]; }
+
+        /**
+         * @brief Gets instructions per cycle
+         * @return IPC, or 0 if cycles were not counted
+         */
+        double instructionsPerCycle() const;
+
+        HardwareCounterValues operator-(const HardwareCounterValues& other) const;
+        HardwareCounterValues& operator+=(const HardwareCounterValues& other);
+    };
+
+    /**
+     * @class HardwareCounters
+     * @brief Counter group opened for the calling thread
+     *
+     * Events the CPU does not support are skipped individually; the rest are
+     * still reported. Readings are scaled when the kernel multiplexes the group.
+     */
+    class HardwareCounters {
+    private:
+        int leaderDescriptor;                      // Group leader file descriptor (-1 = none)
+        std::array<int, HardwareCounterValues::EVENT_COUNT> descriptors;  // Per-event descriptors
+        std::array<bool, HardwareCounterValues::EVENT_COUNT> opened;      // Events in the group
+        size_t openedCount;                        // Number of events in the group
+        std::string unavailableReason;             // Why counting is not possible
+
+    public:
+        /**
+         * @brief Opens and enables the counter group for the calling thread
+         */
+        HardwareCounters();
+        ~HardwareCounters();
+
+        HardwareCounters(const HardwareCounters&) = delete;
+        HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+        /**
+         * @brief Checks whether at least one event is being counted
+         * @return True if counters can be read
+         */
+        bool isAvailable() const;
+
+        /**
+         * @brief Checks whether a specific event is being counted
+         * @param event The event
+         * @return True if the event is part of the group
+         */
+        bool isCounting(HardwareEvent event) const;
+
+        /**
+         * @brief Gets why counters are unavailable
+         * @return Reason text (empty when available)
+         */
+        const std::string& getUnavailableReason() const;
+
+        /**
+         * @brief Reads the cumulative counts since construction
+         * @return Current counter values (zeros when unavailable)
+         */
+        HardwareCounterValues read() const;
+    };
+}
+
+#endif // HARDWARE_COUNTERS_H
@@ -1,4 +1,5 @@
 #include "Individual.h"
+#include "Profiler.h"
 #include <random>
 #include <algorithm>
 #include <sstream>
@@ -7,32 +8,44 @@
 namespace GA {
     
     // Default constructor
-    Individual::Individual() : fitness(0.0), fitnessPercentage(0.0), fitnessCalculated(false) {
+    Individual::Individual() : fitness(0.0), fitnessPercentage(0.0), fitnessCalculated(false),
+          selfAdaptiveRate(0.0), parentFitness(0.0) {
         // Empty chromosome, will be initialized later
     }
     
     // Constructor with chromosome length
-    Individual::Individual(int chromosomeLength) : fitness(0.0), fitnessPercentage(0.0), fitnessCalculated(false) {
+    Individual::Individual(int chromosomeLength) : fitness(0.0), fitnessPercentage(0.0), fitnessCalculated(false),
+          selfAdaptiveRate(0.0), parentFitness(0.0) {
         chromosome.resize(chromosomeLength, false);
+        GA_PROFILE_ALLOCATION();
     }
     
     // Constructor with existing chromosome
     Individual::Individual(const Chromosome& chromosome) 
-        : chromosome(chromosome), fitness(0.0), fitnessPercentage(0.0), fitnessCalculated(false) {
+        : chromosome(chromosome), fitness(0.0), fitnessPercentage(0.0), fitnessCalculated(false),
+          selfAdaptiveRate(0.0), parentFitness(0.0) {
+        GA_PROFILE_ALLOCATION();
     }
     
     // Copy constructor
     Individual::Individual(const Individual& other) 
-        : chromosome(other.chromosome), fitness(other.fitness), fitnessPercentage(other.fitnessPercentage), fitnessCalculated(other.fitnessCalculated) {
+        : chromosome(other.chromosome), fitness(other.fitness), fitnessPercentage(other.fitnessPercentage), fitnessCalculated(other.fitnessCalculated),
+          selfAdaptiveRate(other.selfAdaptiveRate), parentFitness(other.parentFitness) {
+        GA_PROFILE_ALLOCATION();
     }
     
     // Assignment operator
     Individual& Individual::operator=(const Individual& other) {
         if (this != &other) {
+            if (chromosome.capacity() < other.chromosome.size()) {
+                GA_PROFILE_ALLOCATION();
+            }
             chromosome = other.chromosome;
             fitness = other.fitness;
             fitnessPercentage = other.fitnessPercentage;
             fitnessCalculated = other.fitnessCalculated;
+            selfAdaptiveRate = other.selfAdaptiveRate;
+            parentFitness = other.parentFitness;
         }
         return *this;
     }
@@ -49,22 +62,22 @@ namespace GA {
         Chromosome offspring2 = other.chromosome;
         
         // Perform crossover: swap segments after crossover point
+        bool agreeOnExchanged = true;
         for (size_t i = crossoverPoint; i < chromosome.size(); ++i) {
+            agreeOnExchanged = agreeOnExchanged && chromosome[i] == other.chromosome[i];
             offspring1[i] = other.chromosome[i];
             offspring2[i] = chromosome[i];
         }
+        bool agreeOnKept = std::equal(chromosome.begin(), chromosome.begin() + crossoverPoint, other.chromosome.begin());
         
         // Create and return offspring individuals
-        Individual child1(offspring1);
-        Individual child2(offspring2);
-        
-        return std::make_pair(child1, child2);
+        return makeOffspring(*this, other, offspring1, offspring2, agreeOnExchanged, agreeOnKept);
     }
     
     // Two-point crossover implementation
     std::pair<Individual, Individual> Individual::twoPointCrossover(const Individual& other, int point1, int point2) const {
-        // Ensure crossover points are valid and in order
-        if (point1 < 0 || point2 >= static_cast<int>(chromosome.size()) || point1 >= point2) {
+        // Ensure crossover points are valid and in order (equal points swap a single bit)
+        if (point1 < 0 || point2 >= static_cast<int>(chromosome.size()) || point1 > point2) {
             throw std::invalid_argument("Invalid crossover points");
         }
         
@@ -73,16 +86,17 @@ namespace GA {
         Chromosome offspring2 = other.chromosome;
         
         // Perform crossover: swap segment between the two points
+        bool agreeOnExchanged = true;
         for (int i = point1; i <= point2; ++i) {
+            agreeOnExchanged = agreeOnExchanged && chromosome[i] == other.chromosome[i];
             offspring1[i] = other.chromosome[i];
             offspring2[i] = chromosome[i];
         }
+        bool agreeOnKept = std::equal(chromosome.begin(), chromosome.begin() + point1, other.chromosome.begin()) &&
+                           std::equal(chromosome.begin() + point2 + 1, chromosome.end(), other.chromosome.begin() + point2 + 1);
         
         // Create and return offspring individuals
-        Individual child1(offspring1);
-        Individual child2(offspring2);
-        
-        return std::make_pair(child1, child2);
+        return makeOffspring(*this, other, offspring1, offspring2, agreeOnExchanged, agreeOnKept);
     }
     
     // Uniform crossover implementation
@@ -96,22 +110,40 @@ namespace GA {
         Chromosome offspring2(chromosome.size());
         
         // Perform uniform crossover based on mask
+        bool agreeOnExchanged = true;
+        bool agreeOnKept = true;
         for (size_t i = 0; i < chromosome.size(); ++i) {
+            bool agree = chromosome[i] == other.chromosome[i];
             if (mask[i]) {
+                agreeOnKept = agreeOnKept && agree;
                 // Take from first parent for offspring1, second parent for offspring2
                 offspring1[i] = chromosome[i];
                 offspring2[i] = other.chromosome[i];
             } else {
                 // Take from second parent for offspring1, first parent for offspring2
+                agreeOnExchanged = agreeOnExchanged && agree;
                 offspring1[i] = other.chromosome[i];
                 offspring2[i] = chromosome[i];
             }
         }
         
         // Create and return offspring individuals
+        return makeOffspring(*this, other, offspring1, offspring2, agreeOnExchanged, agreeOnKept);
+    }
+    
+    // Offspring equal to a parent inherit its fitness
+    std::pair<Individual, Individual> Individual::makeOffspring(const Individual& parent1, const Individual& parent2,
+                                                                const Chromosome& offspring1, const Chromosome& offspring2,
+                                                                bool agreeOnExchanged, bool agreeOnKept) {
+        if (agreeOnExchanged) {
+            return std::make_pair(parent1, parent2);  // Nothing was actually exchanged
+        }
+        if (agreeOnKept) {
+            return std::make_pair(parent2, parent1);  // Everything that differs was exchanged
+        }
+        
         Individual child1(offspring1);
         Individual child2(offspring2);
-        
         return std::make_pair(child1, child2);
     }
     
@@ -120,14 +152,18 @@ namespace GA {
         std::uniform_real_distribution<double> dist(0.0, 1.0);
         
         // Apply mutation to each bit based on mutation rate
+        bool flipped = false;
         for (size_t i = 0; i < chromosome.size(); ++i) {
             if (dist(rng) < mutationRate) {
                 chromosome[i] = !chromosome[i];  // Flip the bit
+                flipped = true;
             }
         }
         
-        // Invalidate fitness since chromosome has changed
-        invalidateFitness();
+        // Invalidate fitness only if the chromosome has changed
+        if (flipped) {
+            invalidateFitness();
+        }
     }
     
     // Fitness management methods
@@ -160,6 +196,23 @@ namespace GA {
         return fitnessPercentage;
     }
     
+    // Strategy parameter methods
+    void Individual::setSelfAdaptiveRate(double rate) {
+        selfAdaptiveRate = rate;
+    }
+    
+    double Individual::getSelfAdaptiveRate() const {
+        return selfAdaptiveRate;
+    }
+    
+    void Individual::setParentFitness(FitnessValue value) {
+        parentFitness = value;
+    }
+    
+    FitnessValue Individual::getParentFitness() const {
+        return parentFitness;
+    }
+    
     // Chromosome access methods
     const Chromosome& Individual::getChromosome() const {
         return chromosome;
@@ -197,6 +250,43 @@ namespace GA {
         return scaledValue;
     }
     
+    // Decimal to binary conversion (nearest grid point)
+    void Individual::encodeValue(double value, double minValue, double maxValue, size_t length) {
+        uint64_t maxBinaryValue = (1ULL << length) - 1;
+        double position = (maxValue > minValue) ? (value - minValue) / (maxValue - minValue) : 0.0;
+        position = std::max(0.0, std::min(1.0, position));
+        uint64_t binaryValue = static_cast<uint64_t>(std::floor(position * static_cast<double>(maxBinaryValue) + 0.5));
+        binaryValue = std::min(binaryValue, maxBinaryValue);
+        
+        chromosome.assign(length, false);
+        for (size_t i = 0; i < length; ++i) {
+            chromosome[i] = ((binaryValue >> (length - 1 - i)) & 1ULL) != 0;
+        }
+        invalidateFitness();
+    }
+    
+    // Pack chromosome bits into 64-bit words
+    void Individual::packChromosome(uint64_t* words) const {
+        size_t wordCount = (chromosome.size() + 63) / 64;
+        std::fill(words, words + wordCount, 0ULL);
+        
+        for (size_t i = 0; i < chromosome.size(); ++i) {
+            if (chromosome[i]) {
+                words[i / 64] |= (1ULL << (i % 64));
+            }
+        }
+    }
+    
+    // Unpack chromosome bits from 64-bit words
+    void Individual::unpackChromosome(const uint64_t* words, size_t length) {
+        chromosome.resize(length);
+        for (size_t i = 0; i < length; ++i) {
+            chromosome[i] = ((words[i / 64] >> (i % 64)) & 1ULL) != 0;
+        }
+        
+        invalidateFitness();  // Restored chromosome needs its fitness set again
+    }
+    
     // Convert chromosome to string representation
     std::string Individual::toString() const {
         std::stringstream ss;
@@ -5,6 +5,7 @@
 #include <vector>
 #include <string>
 #include <random>
+#include <cstdint>
 
 namespace GA {
     /**
@@ -20,6 +21,22 @@ namespace GA {
         FitnessValue fitness;          // Cached fitness value (raw)
         double fitnessPercentage;      // Fitness as percentage (0-100%)
         bool fitnessCalculated;        // Flag to track if fitness needs recalculation
+        double selfAdaptiveRate;       // Mutation rate carried with the genome (0 = use the global rate)
+        FitnessValue parentFitness;    // Fitness of the better parent (success-based rate control)
+        
+        /**
+         * @brief Wraps crossover chromosomes, reusing a parent when an offspring equals it
+         * @param parent1 Parent that contributes the kept bits of the first offspring
+         * @param parent2 Parent that contributes the exchanged bits of the first offspring
+         * @param offspring1 First offspring chromosome
+         * @param offspring2 Second offspring chromosome
+         * @param agreeOnExchanged Parents have equal bits at every exchanged position
+         * @param agreeOnKept Parents have equal bits at every kept position
+         * @return Pair of offspring individuals
+         */
+        static std::pair<Individual, Individual> makeOffspring(const Individual& parent1, const Individual& parent2,
+                                                               const Chromosome& offspring1, const Chromosome& offspring2,
+                                                               bool agreeOnExchanged, bool agreeOnKept);
         
     public:
         // Constructors
@@ -35,6 +52,8 @@ namespace GA {
         Individual& operator=(const Individual& other);
         
         // Genetic operations
+        // Crossover offspring identical to a parent are copies of that parent,
+        // so they keep its fitness and need no re-evaluation.
         /**
          * @brief Performs single-point crossover with another individual
          * @param other The other parent individual
@@ -47,7 +66,7 @@ namespace GA {
          * @brief Performs two-point crossover with another individual
          * @param other The other parent individual
          * @param point1 First crossover point
-         * @param point2 Second crossover point
+         * @param point2 Second crossover point (inclusive, point1 <= point2)
          * @return Pair of offspring individuals
          */
         std::pair<Individual, Individual> twoPointCrossover(const Individual& other, int point1, int point2) const;
@@ -64,6 +83,8 @@ namespace GA {
          * @brief Performs bit-flip mutation on the chromosome
          * @param mutationRate Probability of each bit being mutated
          * @param rng Random number generator
+         *
+         * Fitness is invalidated only if at least one bit flipped.
          */
         void mutate(double mutationRate, std::mt19937& rng);
         
@@ -103,6 +124,31 @@ namespace GA {
          */
         double getFitnessPercentage() const;
         
+        // Strategy parameters for operator rate control
+        /**
+         * @brief Sets the mutation rate this individual carries (self-adaptive rate control)
+         * @param rate Mutation rate (0 = use the global rate)
+         */
+        void setSelfAdaptiveRate(double rate);
+        
+        /**
+         * @brief Gets the mutation rate this individual carries
+         * @return Mutation rate (0 = use the global rate)
+         */
+        double getSelfAdaptiveRate() const;
+        
+        /**
+         * @brief Records the fitness of the better parent this individual was bred from
+         * @param value Parent fitness
+         */
+        void setParentFitness(FitnessValue value);
+        
+        /**
+         * @brief Gets the fitness of the better parent
+         * @return Parent fitness (0 until recorded)
+         */
+        FitnessValue getParentFitness() const;
+        
         // Chromosome access and manipulation
         /**
          * @brief Gets the chromosome (read-only)
@@ -131,6 +177,28 @@ namespace GA {
          */
         double decodeToValue(double minValue, double maxValue) const;
         
+        /**
+         * @brief Sets the chromosome to the grid point nearest a decimal value (inverse of decodeToValue)
+         * @param value Value to encode (clamped to the domain)
+         * @param minValue Minimum value of the domain
+         * @param maxValue Maximum value of the domain
+         * @param length Number of bits (at most 63)
+         */
+        void encodeValue(double value, double minValue, double maxValue, size_t length);
+        
+        /**
+         * @brief Packs the chromosome into 64-bit words (bit i goes to word i / 64, position i % 64)
+         * @param words Destination buffer holding at least (length + 63) / 64 words
+         */
+        void packChromosome(uint64_t* words) const;
+        
+        /**
+         * @brief Rebuilds the chromosome from packed 64-bit words
+         * @param words Source buffer produced by packChromosome
+         * @param length Number of bits to unpack
+         */
+        void unpackChromosome(const uint64_t* words, size_t length);
+        
         /**
          * @brief Converts the chromosome to a binary string representation
          * @return String representation of the chromosome
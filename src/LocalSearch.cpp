@@ -0,0 +1,260 @@
+#include "LocalSearch.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace GA {
+    namespace {
+        // Integer value of a chromosome (most significant bit first, as in decodeToValue)
+        uint64_t chromosomeValue(const Chromosome& chromosome) {
+            uint64_t value = 0;
+            for (size_t i = 0; i < chromosome.size(); ++i) {
+                if (chromosome[i]) {
+                    value |= (1ULL << (chromosome.size() - 1 - i));
+                }
+            }
+            return value;
+        }
+    }
+
+    // Constructor
+    LocalSearch::LocalSearch(const FitnessFunction& function, const GAConfig& config)
+        : function(function), type(config.localSearch), minValue(config.minValue), maxValue(config.maxValue),
+          maximize(config.isMaximization) {
+    }
+
+    bool LocalSearch::better(FitnessValue candidate, FitnessValue incumbent) const {
+        return maximize ? candidate > incumbent : candidate < incumbent;
+    }
+
+    uint64_t LocalSearch::improve(Individual& individual, uint64_t maxEvaluations) const {
+        if (maxEvaluations == 0 || !individual.isFitnessValid() || individual.getChromosomeLength() == 0) {
+            return 0;
+        }
+
+        switch (type) {
+            case LocalSearchType::HILL_CLIMB:
+                return hillClimb(individual, maxEvaluations);
+            case LocalSearchType::BRENT:
+                return brentSearch(individual, maxEvaluations);
+            default:
+                return 0;
+        }
+    }
+
+    // First-improvement bit-flip hill climbing with O(1) decoding per neighbour
+    uint64_t LocalSearch::hillClimb(Individual& individual, uint64_t maxEvaluations) const {
+        Chromosome chromosome = individual.getChromosome();
+        size_t length = chromosome.size();
+        uint64_t maxBinaryValue = (1ULL << length) - 1;
+        uint64_t value = chromosomeValue(chromosome);
+        FitnessValue fitness = individual.getFitness();
+
+        uint64_t evaluations = 0;
+        bool improved = true;
+        bool changed = false;
+        while (improved && evaluations < maxEvaluations) {
+            improved = false;
+            for (size_t bit = 0; bit < length && evaluations < maxEvaluations; ++bit) {
+                uint64_t neighbour = value ^ (1ULL << bit);
+                double x = minValue + (static_cast<double>(neighbour) / maxBinaryValue) * (maxValue - minValue);
+                FitnessValue candidate = function.evaluate(x);
+                evaluations++;
+                if (better(candidate, fitness)) {
+                    value = neighbour;
+                    fitness = candidate;
+                    improved = true;
+                    changed = true;
+                }
+            }
+        }
+
+        if (changed) {
+            for (size_t i = 0; i < length; ++i) {
+                chromosome[i] = ((value >> (length - 1 - i)) & 1ULL) != 0;
+            }
+            individual.setChromosome(chromosome);
+            individual.setFitness(fitness);
+        }
+        return evaluations;
+    }
+
+    // Bracket the decoded value, run Brent's method and snap the minimum to the grid
+    uint64_t LocalSearch::brentSearch(Individual& individual, uint64_t maxEvaluations) const {
+        const double goldenSection = 0.3819660112501051;  // 2 - golden ratio
+        size_t length = individual.getChromosomeLength();
+        double gridStep = (maxValue - minValue) / (std::ldexp(1.0, static_cast<int>(length)) - 1.0);
+        double sign = maximize ? -1.0 : 1.0;             // Brent's method minimizes sign * f
+
+        uint64_t evaluations = 0;
+        auto objective = [&](double x) {
+            evaluations++;
+            return sign * function.evaluate(x);
+        };
+
+        double x = individual.decodeToValue(minValue, maxValue);
+        double fx = sign * individual.getFitness();
+
+        // Widen [x - h, x + h] until both ends are no better than x (or the domain ends)
+        double h = 4.0 * gridStep;
+        double a = x;
+        double b = x;
+        while (evaluations + 2 < maxEvaluations) {
+            a = std::max(minValue, x - h);
+            b = std::min(maxValue, x + h);
+            bool leftOpen = a > minValue && objective(a) < fx;
+            bool rightOpen = b < maxValue && objective(b) < fx;
+            if (!leftOpen && !rightOpen) {
+                break;
+            }
+            h *= 2.0;
+        }
+        if (b - a <= gridStep) {
+            return evaluations;
+        }
+
+        // Brent's localmin: v and w are the previous best points, e the step before last
+        double v = x, w = x, fv = fx, fw = fx;
+        double d = 0.0, e = 0.0;
+        double tolerance = 0.5 * gridStep;
+        while (evaluations + 1 < maxEvaluations) {
+            double middle = 0.5 * (a + b);
+            if (std::abs(x - middle) <= 2.0 * tolerance - 0.5 * (b - a)) {
+                break;
+            }
+
+            bool golden = true;
+            if (std::abs(e) > tolerance) {
+                // Parabola through x, v and w
+                double r = (x - w) * (fx - fv);
+                double q = (x - v) * (fx - fw);
+                double p = (x - v) * q - (x - w) * r;
+                q = 2.0 * (q - r);
+                if (q > 0.0) {
+                    p = -p;
+                }
+                q = std::abs(q);
+                double previous = e;
+                e = d;
+                if (std::abs(p) < std::abs(0.5 * q * previous) && p > q * (a - x) && p < q * (b - x)) {
+                    d = p / q;
+                    double u = x + d;
+                    if (u - a < 2.0 * tolerance || b - u < 2.0 * tolerance) {
+                        d = (x < middle) ? tolerance : -tolerance;
+                    }
+                    golden = false;
+                }
+            }
+            if (golden) {
+                e = (x < middle) ? b - x : a - x;
+                d = goldenSection * e;
+            }
+
+            double u = (std::abs(d) >= tolerance) ? x + d : x + (d > 0.0 ? tolerance : -tolerance);
+            double fu = objective(u);
+            if (fu <= fx) {
+                if (u < x) {
+                    b = x;
+                } else {
+                    a = x;
+                }
+                v = w; fv = fw;
+                w = x; fw = fx;
+                x = u; fx = fu;
+            } else {
+                if (u < x) {
+                    a = u;
+                } else {
+                    b = u;
+                }
+                if (fu <= fw || w == x) {
+                    v = w; fv = fw;
+                    w = u; fw = fu;
+                } else if (fu <= fv || v == x || v == w) {
+                    v = u; fv = fu;
+                }
+            }
+        }
+
+        // The genotype can only hold grid points: evaluate the nearest one
+        Individual candidate;
+        candidate.encodeValue(x, minValue, maxValue, length);
+        if (candidate.getChromosome() == individual.getChromosome()) {
+            return evaluations;
+        }
+        FitnessValue fitness = function.evaluate(candidate.decodeToValue(minValue, maxValue));
+        evaluations++;
+        if (better(fitness, individual.getFitness())) {
+            individual.setChromosome(candidate.getChromosome());
+            individual.setFitness(fitness);
+        }
+        return evaluations;
+    }
+
+    // Newton's method on sign * f with step halving and a gradient fallback
+    PolishedSolution LocalSearch::newtonPolish(double start, int maxIterations) const {
+        PolishedSolution result;
+        result.value = std::min(maxValue, std::max(minValue, start));
+        if (!function.supportsDerivatives()) {
+            result.fitness = function.evaluate(result.value);
+            return result;
+        }
+        result.available = true;
+
+        double sign = maximize ? -1.0 : 1.0;             // Minimize sign * f
+        double x = result.value;
+        Dual current = function.evaluateDual(Dual::variable(x));
+        result.evaluations++;
+        double gradientStep = (maxValue - minValue) * 1e-3;  // Trust length for gradient steps
+
+        while (result.iterations < maxIterations) {
+            double slope = sign * current.first;
+            double curvature = sign * current.second;
+            if (slope == 0.0) {
+                result.converged = true;
+                break;
+            }
+            result.iterations++;
+
+            // Newton step where the model is convex, otherwise a downhill gradient step
+            double step = curvature > 0.0 ? -slope / curvature : (slope > 0.0 ? -gradientStep : gradientStep);
+            double tolerance = 4.0 * std::numeric_limits<double>::epsilon() * std::max(1.0, std::abs(x));
+            bool accepted = false;
+            Dual candidate;
+            double next = x;
+            while (std::abs(step) > tolerance) {
+                next = std::min(maxValue, std::max(minValue, x + step));
+                if (next == x) {
+                    break;
+                }
+                candidate = function.evaluateDual(Dual::variable(next));
+                result.evaluations++;
+                if (sign * candidate.value <= sign * current.value) {
+                    accepted = true;
+                    break;
+                }
+                step *= 0.5;
+            }
+
+            if (!accepted) {
+                result.converged = true;             // No representable step improves f
+                break;
+            }
+            double moved = std::abs(next - x);
+            x = next;
+            current = candidate;
+            if (curvature <= 0.0) {
+                gradientStep *= 2.0;
+            }
+            if (moved <= tolerance) {
+                result.converged = true;
+                break;
+            }
+        }
+
+        result.value = x;
+        result.fitness = current.value;
+        result.derivative = current.first;
+        return result;
+    }
+}
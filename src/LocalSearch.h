@@ -0,0 +1,65 @@
+#ifndef LOCAL_SEARCH_H
+#define LOCAL_SEARCH_H
+
+#include "GeneticTypes.h"
+#include "Individual.h"
+#include "FitnessFunction.h"
+#include <cstdint>
+
+namespace GA {
+    /**
+     * @class LocalSearch
+     * @brief Local optimizers that polish one evaluated individual in the current encoding
+     *
+     * HILL_CLIMB flips single bits (least significant first) and keeps every
+     * improvement, decoding neighbours incrementally from the integer value of
+     * the chromosome. BRENT brackets the decoded value and minimizes with
+     * Brent's method (golden-section steps with parabolic interpolation), then
+     * snaps the result to the nearest grid point. improve() is const and may
+     * be called concurrently for different individuals. newtonPolish() refines
+     * a decoded value off the grid using the function's derivatives.
+     */
+    class LocalSearch {
+    private:
+        const FitnessFunction& function;
+        LocalSearchType type;
+        double minValue;                           // Domain of the current encoding
+        double maxValue;
+        bool maximize;                             // Whether higher fitness is better
+
+        bool better(FitnessValue candidate, FitnessValue incumbent) const;
+        uint64_t hillClimb(Individual& individual, uint64_t maxEvaluations) const;
+        uint64_t brentSearch(Individual& individual, uint64_t maxEvaluations) const;
+
+    public:
+        /**
+         * @brief Creates a local optimizer for the domain and direction of a configuration
+         * @param function Objective (evaluate() must be thread-safe for concurrent use)
+         * @param config Configuration providing localSearch, the domain and the direction
+         */
+        LocalSearch(const FitnessFunction& function, const GAConfig& config);
+
+        /**
+         * @brief Improves an evaluated individual in place
+         * @param individual Individual to polish (chromosome and fitness change only on improvement)
+         * @param maxEvaluations Fitness evaluations allowed
+         * @return Fitness evaluations used
+         */
+        uint64_t improve(Individual& individual, uint64_t maxEvaluations) const;
+
+        /**
+         * @brief Polishes a decoded value with safeguarded Newton iterations on f' and f''
+         * @param start Starting x inside the domain
+         * @param maxIterations Newton iterations allowed
+         * @return Polished value and fitness (available is false without derivatives)
+         *
+         * Uses FitnessFunction::evaluateDual. Steps that do not improve the
+         * fitness are halved; where f'' has the wrong sign for the direction a
+         * gradient step is taken instead. The value is kept inside the domain
+         * and is not snapped to the chromosome grid.
+         */
+        PolishedSolution newtonPolish(double start, int maxIterations = 50) const;
+    };
+}
+
+#endif // LOCAL_SEARCH_H
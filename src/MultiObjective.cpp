@@ -0,0 +1,570 @@
+#include "MultiObjective.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace GA {
+    namespace {
+        // Smallest number of individuals handed to an evaluation worker
+        const size_t MULTI_OBJECTIVE_CHUNK_MIN = 16;
+
+        // Minimization cost of an objective value; NaN counts as the worst possible value
+        double objectiveCost(double sign, double value) {
+            return std::isnan(value) ? std::numeric_limits<double>::infinity() : sign * value;
+        }
+
+        // Whether row a Pareto-dominates row b (all costs <=, at least one <)
+        bool dominates(const double* a, const double* b, size_t objectiveCount) {
+            bool strictlyBetter = false;
+            for (size_t m = 0; m < objectiveCount; ++m) {
+                if (a[m] > b[m]) {
+                    return false;
+                }
+                if (a[m] < b[m]) {
+                    strictlyBetter = true;
+                }
+            }
+            return strictlyBetter;
+        }
+
+        // Rows in lexicographic cost order
+        void lexicographicOrder(const std::vector<double>& costs, size_t objectiveCount, std::vector<size_t>& order) {
+            order.resize(costs.size() / objectiveCount);
+            std::iota(order.begin(), order.end(), size_t(0));
+            std::sort(order.begin(), order.end(), [&costs, objectiveCount](size_t a, size_t b) {
+                const double* rowA = &costs[a * objectiveCount];
+                const double* rowB = &costs[b * objectiveCount];
+                return std::lexicographical_compare(rowA, rowA + objectiveCount, rowB, rowB + objectiveCount);
+            });
+        }
+
+        // Removes the most crowded row from kept until capacity rows remain
+        //
+        // Dropping a row only changes the crowding distance of its neighbours in
+        // each objective, so neighbours are kept in linked lists and distances in
+        // a lazy min-heap: O(M K log K) instead of a full recomputation per row.
+        // Objective ranges stay those of the initial set; objectives with an
+        // infinite range (infinite or NaN values) do not contribute.
+        void pruneByCrowding(const std::vector<double>& costs, size_t objectiveCount, std::vector<size_t>& kept,
+                             size_t capacity) {
+            size_t count = kept.size();
+            if (count <= capacity) {
+                return;
+            }
+
+            const size_t NONE = count;
+            std::vector<size_t> previous(count * objectiveCount);
+            std::vector<size_t> next(count * objectiveCount);
+            std::vector<double> ranges(objectiveCount);
+            std::vector<size_t> sorted(count);
+            for (size_t m = 0; m < objectiveCount; ++m) {
+                std::iota(sorted.begin(), sorted.end(), size_t(0));
+                std::sort(sorted.begin(), sorted.end(), [&](size_t a, size_t b) {
+                    return costs[kept[a] * objectiveCount + m] < costs[kept[b] * objectiveCount + m];
+                });
+                for (size_t i = 0; i < count; ++i) {
+                    previous[sorted[i] * objectiveCount + m] = (i > 0) ? sorted[i - 1] : NONE;
+                    next[sorted[i] * objectiveCount + m] = (i + 1 < count) ? sorted[i + 1] : NONE;
+                }
+                ranges[m] = costs[kept[sorted.back()] * objectiveCount + m] - costs[kept[sorted.front()] * objectiveCount + m];
+            }
+
+            auto distance = [&](size_t i) {
+                double total = 0.0;
+                for (size_t m = 0; m < objectiveCount; ++m) {
+                    size_t before = previous[i * objectiveCount + m];
+                    size_t after = next[i * objectiveCount + m];
+                    if (before == NONE || after == NONE) {
+                        return std::numeric_limits<double>::infinity();
+                    }
+                    if (ranges[m] > 0.0 && std::isfinite(ranges[m])) {
+                        total += (costs[kept[after] * objectiveCount + m] - costs[kept[before] * objectiveCount + m]) /
+                                 ranges[m];
+                    }
+                }
+                return total;
+            };
+
+            // Smallest distance first, earlier rows first among ties
+            using Entry = std::pair<double, size_t>;
+            std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+            std::vector<double> current(count);
+            std::vector<bool> removed(count, false);
+            for (size_t i = 0; i < count; ++i) {
+                current[i] = distance(i);
+                heap.push(Entry(current[i], i));
+            }
+
+            size_t alive = count;
+            while (alive > capacity) {
+                Entry top = heap.top();
+                heap.pop();
+                size_t i = top.second;
+                if (removed[i] || top.first != current[i]) {
+                    continue;  // Stale entry
+                }
+
+                removed[i] = true;
+                alive--;
+                for (size_t m = 0; m < objectiveCount; ++m) {
+                    size_t before = previous[i * objectiveCount + m];
+                    size_t after = next[i * objectiveCount + m];
+                    if (before != NONE) {
+                        next[before * objectiveCount + m] = after;
+                    }
+                    if (after != NONE) {
+                        previous[after * objectiveCount + m] = before;
+                    }
+                }
+                for (size_t m = 0; m < objectiveCount; ++m) {
+                    for (size_t neighbour : {previous[i * objectiveCount + m], next[i * objectiveCount + m]}) {
+                        if (neighbour != NONE && !removed[neighbour]) {
+                            current[neighbour] = distance(neighbour);
+                            heap.push(Entry(current[neighbour], neighbour));
+                        }
+                    }
+                }
+            }
+
+            size_t write = 0;
+            for (size_t i = 0; i < count; ++i) {
+                if (!removed[i]) {
+                    kept[write++] = kept[i];
+                }
+            }
+            kept.resize(write);
+        }
+    }
+
+    void paretoRanks(const std::vector<double>& costs, size_t objectiveCount, std::vector<int>& ranks) {
+        size_t count = costs.size() / objectiveCount;
+        ranks.assign(count, 0);
+        if (count == 0) {
+            return;
+        }
+
+        std::vector<size_t> order;
+        lexicographicOrder(costs, objectiveCount, order);
+
+        if (objectiveCount == 1) {
+            // Ranks are the distinct cost levels
+            int rank = 0;
+            for (size_t i = 1; i < count; ++i) {
+                if (costs[order[i]] > costs[order[i - 1]]) {
+                    rank++;
+                }
+                ranks[order[i]] = rank;
+            }
+            return;
+        }
+
+        if (objectiveCount == 2) {
+            // Every earlier row has a smaller or equal first cost, so front k dominates
+            // the row iff its last member's second cost is <= (and the rows differ)
+            std::vector<size_t> frontLast;
+            for (size_t row : order) {
+                const double* point = &costs[row * 2];
+                size_t low = 0;
+                size_t high = frontLast.size();
+                while (low < high) {
+                    size_t mid = (low + high) / 2;
+                    const double* last = &costs[frontLast[mid] * 2];
+                    bool dominated = last[1] <= point[1] && !(last[0] == point[0] && last[1] == point[1]);
+                    if (dominated) {
+                        low = mid + 1;
+                    } else {
+                        high = mid;
+                    }
+                }
+                if (low == frontLast.size()) {
+                    frontLast.push_back(row);
+                } else {
+                    frontLast[low] = row;
+                }
+                ranks[row] = static_cast<int>(low);
+            }
+            return;
+        }
+
+        // ENS-SS: first front none of whose members dominates the row (newest members first)
+        std::vector<std::vector<size_t>> fronts;
+        for (size_t row : order) {
+            const double* point = &costs[row * objectiveCount];
+            size_t front = 0;
+            for (; front < fronts.size(); ++front) {
+                bool dominated = false;
+                for (auto member = fronts[front].rbegin(); member != fronts[front].rend(); ++member) {
+                    if (dominates(&costs[*member * objectiveCount], point, objectiveCount)) {
+                        dominated = true;
+                        break;
+                    }
+                }
+                if (!dominated) {
+                    break;
+                }
+            }
+            if (front == fronts.size()) {
+                fronts.emplace_back();
+            }
+            fronts[front].push_back(row);
+            ranks[row] = static_cast<int>(front);
+        }
+    }
+
+    void crowdingDistances(const std::vector<double>& costs, size_t objectiveCount, const std::vector<size_t>& front,
+                           std::vector<double>& distances) {
+        for (size_t row : front) {
+            distances[row] = 0.0;
+        }
+        if (front.size() <= 2) {
+            for (size_t row : front) {
+                distances[row] = std::numeric_limits<double>::infinity();
+            }
+            return;
+        }
+
+        std::vector<size_t> sorted(front);
+        for (size_t m = 0; m < objectiveCount; ++m) {
+            std::sort(sorted.begin(), sorted.end(), [&costs, objectiveCount, m](size_t a, size_t b) {
+                return costs[a * objectiveCount + m] < costs[b * objectiveCount + m];
+            });
+            double low = costs[sorted.front() * objectiveCount + m];
+            double high = costs[sorted.back() * objectiveCount + m];
+            distances[sorted.front()] = std::numeric_limits<double>::infinity();
+            distances[sorted.back()] = std::numeric_limits<double>::infinity();
+            if (!(high > low) || !std::isfinite(high - low)) {
+                continue;  // No spread, or infinite values that would make the distances NaN
+            }
+            for (size_t i = 1; i + 1 < sorted.size(); ++i) {
+                distances[sorted[i]] += (costs[sorted[i + 1] * objectiveCount + m] -
+                                         costs[sorted[i - 1] * objectiveCount + m]) / (high - low);
+            }
+        }
+    }
+
+    // Constructor
+    MultiObjectiveGA::MultiObjectiveGA(const GAConfig& config, std::vector<std::unique_ptr<FitnessFunction>> objectives)
+        : config(config), objectives(std::move(objectives)), evaluationCount(0) {
+        if (config.randomSeed != 0) {
+            rng.seed(config.randomSeed);
+        } else {
+            std::random_device rd;
+            rng.seed(rd());
+        }
+
+        if (config.populationSize < 2 || config.chromosomeLength <= 0 || config.maxGenerations <= 0 ||
+            config.evaluationThreads < 0 || config.timeLimitSeconds < 0.0 || config.paretoArchiveSize <= 0) {
+            throw std::invalid_argument("Invalid GA configuration parameters");
+        }
+        if (config.maxEvaluations > 0 && config.maxEvaluations < static_cast<uint64_t>(config.populationSize)) {
+            throw std::invalid_argument("maxEvaluations must cover at least the initial population");
+        }
+        if (this->objectives.empty()) {
+            throw std::invalid_argument("At least one objective is required");
+        }
+        for (const auto& objective : this->objectives) {
+            if (!objective) {
+                throw std::invalid_argument("Fitness function cannot be null");
+            }
+            costSigns.push_back(objective->isMaximizationProblem() ? -1.0 : 1.0);
+        }
+    }
+
+    // Workers for evaluation (nullptr = calling thread only)
+    ThreadPool* MultiObjectiveGA::getWorkerPool() {
+        if (config.evaluationThreads == 1) {
+            return nullptr;
+        }
+
+        int threads = config.evaluationThreads > 0
+                          ? config.evaluationThreads
+                          : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        if (!evaluationPool || evaluationPool->getThreadCount() != threads) {
+            evaluationPool = std::make_unique<ThreadPool>(threads);
+        }
+        return evaluationPool.get();
+    }
+
+    // Evaluate every objective for the given slots (one batch per objective and chunk)
+    void MultiObjectiveGA::evaluateSlots(const std::vector<size_t>& slots) {
+        size_t count = slots.size();
+        size_t objectiveCount = objectives.size();
+        batchInputs.resize(count);
+        batchOutputs.resize(count * objectiveCount);
+
+        auto body = [this, &slots, count, objectiveCount](size_t begin, size_t end, int) {
+            for (size_t i = begin; i < end; ++i) {
+                positions[slots[i]] = store[slots[i]].decodeToValue(config.minValue, config.maxValue);
+                batchInputs[i] = positions[slots[i]];
+            }
+            for (size_t m = 0; m < objectiveCount; ++m) {
+                objectives[m]->evaluateBatch(&batchInputs[begin], &batchOutputs[m * count + begin], end - begin);
+            }
+        };
+        ThreadPool* pool = getWorkerPool();
+        if (pool && count > MULTI_OBJECTIVE_CHUNK_MIN) {
+            pool->parallelFor(count, body, MULTI_OBJECTIVE_CHUNK_MIN);
+        } else {
+            body(0, count, 0);
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t m = 0; m < objectiveCount; ++m) {
+                values[slots[i] * objectiveCount + m] = batchOutputs[m * count + i];
+            }
+        }
+        evaluationCount += count;
+    }
+
+    // Pareto ranks and crowding distances of the given slots (fronts is left holding their rows)
+    void MultiObjectiveGA::rankSlots(const std::vector<size_t>& slots) {
+        size_t objectiveCount = objectives.size();
+        rankedSlots.assign(slots.begin(), slots.end());
+        costs.resize(slots.size() * objectiveCount);
+        for (size_t row = 0; row < slots.size(); ++row) {
+            for (size_t m = 0; m < objectiveCount; ++m) {
+                costs[row * objectiveCount + m] = objectiveCost(costSigns[m], values[slots[row] * objectiveCount + m]);
+            }
+        }
+
+        paretoRanks(costs, objectiveCount, rowRanks);
+        int frontCount = rowRanks.empty() ? 0 : *std::max_element(rowRanks.begin(), rowRanks.end()) + 1;
+        fronts.resize(frontCount);
+        for (std::vector<size_t>& front : fronts) {
+            front.clear();
+        }
+        for (size_t row = 0; row < slots.size(); ++row) {
+            fronts[rowRanks[row]].push_back(row);
+        }
+
+        rowCrowding.resize(slots.size());
+        for (const std::vector<size_t>& front : fronts) {
+            crowdingDistances(costs, objectiveCount, front, rowCrowding);
+        }
+        for (size_t row = 0; row < slots.size(); ++row) {
+            ranks[slots[row]] = rowRanks[row];
+            crowding[slots[row]] = rowCrowding[row];
+        }
+    }
+
+    // Binary tournament on (rank, crowding distance)
+    size_t MultiObjectiveGA::crowdedTournament() {
+        std::uniform_int_distribution<size_t> dist(0, parents.size() - 1);
+        size_t a = parents[dist(rng)];
+        size_t b = parents[dist(rng)];
+        if (ranks[b] < ranks[a] || (ranks[b] == ranks[a] && crowding[b] > crowding[a])) {
+            return b;
+        }
+        return a;
+    }
+
+    std::pair<Individual, Individual> MultiObjectiveGA::crossover(const Individual& parent1, const Individual& parent2) {
+        std::uniform_int_distribution<int> pointDist(1, config.chromosomeLength - 1);
+
+        switch (config.crossoverType) {
+            case CrossoverType::SINGLE_POINT:
+                return parent1.singlePointCrossover(parent2, pointDist(rng));
+
+            case CrossoverType::TWO_POINT: {
+                int point1 = pointDist(rng);
+                int point2 = pointDist(rng);
+                if (point1 > point2) {
+                    std::swap(point1, point2);
+                }
+                return parent1.twoPointCrossover(parent2, point1, point2);
+            }
+
+            case CrossoverType::UNIFORM: {
+                Chromosome mask(config.chromosomeLength);
+                std::uniform_int_distribution<int> maskDist(0, 1);
+                for (int i = 0; i < config.chromosomeLength; ++i) {
+                    mask[i] = (maskDist(rng) == 1);
+                }
+                return parent1.uniformCrossover(parent2, mask);
+            }
+
+            default:
+                throw std::invalid_argument("Unknown crossover type");
+        }
+    }
+
+    // Fill the free slots with mutated offspring of tournament winners
+    void MultiObjectiveGA::breedOffspring() {
+        std::uniform_real_distribution<double> chance(0.0, 1.0);
+        for (size_t i = 0; i < freeSlots.size(); i += 2) {
+            size_t first = crowdedTournament();
+            size_t second = crowdedTournament();
+            std::pair<Individual, Individual> offspring = (chance(rng) < config.crossoverRate)
+                                                              ? crossover(store[first], store[second])
+                                                              : std::make_pair(store[first], store[second]);
+            offspring.first.mutate(config.mutationRate, rng);
+            offspring.second.mutate(config.mutationRate, rng);
+
+            store[freeSlots[i]] = offspring.first;
+            if (i + 1 < freeSlots.size()) {
+                store[freeSlots[i + 1]] = offspring.second;
+            }
+        }
+    }
+
+    // (mu + lambda) survival: whole fronts, then the least crowded of the splitting front
+    void MultiObjectiveGA::selectSurvivors() {
+        std::vector<size_t> candidates(parents);
+        candidates.insert(candidates.end(), freeSlots.begin(), freeSlots.end());
+        rankSlots(candidates);
+
+        size_t target = static_cast<size_t>(config.populationSize);
+        parents.clear();
+        freeSlots.clear();
+        for (std::vector<size_t>& front : fronts) {
+            if (parents.size() + front.size() > target && parents.size() < target) {
+                // Stable so equally crowded rows keep parents ahead of offspring
+                std::vector<size_t> byCrowding(front);
+                std::stable_sort(byCrowding.begin(), byCrowding.end(), [this](size_t a, size_t b) {
+                    return rowCrowding[a] > rowCrowding[b];
+                });
+                size_t needed = target - parents.size();
+                for (size_t i = 0; i < byCrowding.size(); ++i) {
+                    (i < needed ? parents : freeSlots).push_back(rankedSlots[byCrowding[i]]);
+                }
+                continue;
+            }
+            for (size_t row : front) {
+                (parents.size() < target ? parents : freeSlots).push_back(rankedSlots[row]);
+            }
+        }
+    }
+
+    // Merge the last ranking's first front into the archive, then prune it to paretoArchiveSize
+    void MultiObjectiveGA::updateArchive() {
+        size_t objectiveCount = objectives.size();
+        if (!fronts.empty()) {
+            for (size_t row : fronts[0]) {
+                size_t slot = rankedSlots[row];
+                ParetoSolution solution;
+                solution.individual = store[slot];
+                solution.value = positions[slot];
+                solution.objectives.assign(values.begin() + slot * objectiveCount,
+                                           values.begin() + (slot + 1) * objectiveCount);
+                archive.push_back(solution);
+            }
+        }
+
+        // Keep the non-dominated entries, one per objective vector (earlier entries win)
+        std::vector<double> archiveCosts(archive.size() * objectiveCount);
+        for (size_t i = 0; i < archive.size(); ++i) {
+            for (size_t m = 0; m < objectiveCount; ++m) {
+                archiveCosts[i * objectiveCount + m] = objectiveCost(costSigns[m], archive[i].objectives[m]);
+            }
+        }
+        std::vector<int> archiveRanks;
+        paretoRanks(archiveCosts, objectiveCount, archiveRanks);
+
+        std::vector<size_t> order;
+        lexicographicOrder(archiveCosts, objectiveCount, order);
+        std::vector<size_t> kept;
+        for (size_t i = 0; i < order.size(); ++i) {
+            size_t row = order[i];
+            if (archiveRanks[row] != 0) {
+                continue;
+            }
+            if (!kept.empty() && std::equal(&archiveCosts[kept.back() * objectiveCount],
+                                            &archiveCosts[kept.back() * objectiveCount] + objectiveCount,
+                                            &archiveCosts[row * objectiveCount])) {
+                if (row < kept.back()) {
+                    kept.back() = row;
+                }
+                continue;
+            }
+            kept.push_back(row);
+        }
+
+        // Drop the most crowded entry until the archive fits
+        pruneByCrowding(archiveCosts, objectiveCount, kept, static_cast<size_t>(config.paretoArchiveSize));
+
+        std::sort(kept.begin(), kept.end());
+        for (size_t i = 0; i < kept.size(); ++i) {
+            if (kept[i] != i) {
+                archive[i] = archive[kept[i]];
+            }
+        }
+        archive.resize(kept.size());
+    }
+
+    // Main algorithm execution
+    MultiObjectiveResult MultiObjectiveGA::run(ProgressCallback callback) {
+        auto start = std::chrono::steady_clock::now();
+        size_t populationSize = static_cast<size_t>(config.populationSize);
+        size_t objectiveCount = objectives.size();
+        evaluationCount = 0;
+        archive.clear();
+
+        // Parents occupy the first half of the store, offspring go to the second
+        store.resize(2 * populationSize);
+        values.assign(2 * populationSize * objectiveCount, 0.0);
+        positions.assign(2 * populationSize, 0.0);
+        ranks.assign(2 * populationSize, 0);
+        crowding.assign(2 * populationSize, 0.0);
+        parents.resize(populationSize);
+        std::iota(parents.begin(), parents.end(), size_t(0));
+        freeSlots.resize(populationSize);
+        std::iota(freeSlots.begin(), freeSlots.end(), populationSize);
+
+        for (size_t slot : parents) {
+            store[slot].randomize(config.chromosomeLength, rng);
+        }
+        evaluateSlots(parents);
+        rankSlots(parents);
+        updateArchive();
+
+        MultiObjectiveResult result;
+        result.terminationReason = "Maximum generations reached";
+        for (int generation = 1; generation <= config.maxGenerations; ++generation) {
+            if (config.maxEvaluations > 0 && evaluationCount + populationSize > config.maxEvaluations) {
+                result.terminationReason = "Evaluation limit of " + std::to_string(config.maxEvaluations) + " reached";
+                break;
+            }
+            if (config.timeLimitSeconds > 0.0 &&
+                std::chrono::steady_clock::now() - start >= std::chrono::duration<double>(config.timeLimitSeconds)) {
+                std::ostringstream reason;
+                reason << "Time limit of " << config.timeLimitSeconds << " s reached";
+                result.terminationReason = reason.str();
+                break;
+            }
+
+            breedOffspring();
+            evaluateSlots(freeSlots);
+            selectSurvivors();
+            updateArchive();
+            result.generations = generation;
+
+            if (callback) {
+                callback(generation, fronts.empty() ? 0 : fronts[0].size(), archive.size());
+            }
+        }
+
+        result.front = archive;
+        std::sort(result.front.begin(), result.front.end(), [](const ParetoSolution& a, const ParetoSolution& b) {
+            if (std::isnan(a.objectives[0]) || std::isnan(b.objectives[0])) {
+                return !std::isnan(a.objectives[0]) && std::isnan(b.objectives[0]);  // NaN last
+            }
+            return a.objectives[0] < b.objectives[0];
+        });
+        result.evaluations = evaluationCount;
+        result.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return result;
+    }
+
+    const std::vector<ParetoSolution>& MultiObjectiveGA::getArchive() const {
+        return archive;
+    }
+
+    size_t MultiObjectiveGA::getObjectiveCount() const {
+        return objectives.size();
+    }
+}
@@ -0,0 +1,152 @@
+#ifndef MULTI_OBJECTIVE_H
+#define MULTI_OBJECTIVE_H
+
+#include "GeneticTypes.h"
+#include "Individual.h"
+#include "FitnessFunction.h"
+#include "ThreadPool.h"
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace GA {
+    /**
+     * @struct ParetoSolution
+     * @brief One non-dominated solution of a multi-objective run
+     */
+    struct ParetoSolution {
+        Individual individual;                     // Chromosome of the solution
+        double value = 0.0;                        // Decoded value
+        std::vector<FitnessValue> objectives;      // One value per objective, in each function's own direction
+    };
+
+    /**
+     * @struct MultiObjectiveResult
+     * @brief Pareto front and accounting of a multi-objective run
+     */
+    struct MultiObjectiveResult {
+        std::vector<ParetoSolution> front;         // Archive contents, ordered by the first objective
+        int generations = 0;                       // Generations completed
+        uint64_t evaluations = 0;                  // Objective vectors evaluated (one per individual)
+        double wallSeconds = 0.0;                  // Wall time of the run
+        std::string terminationReason;             // Why the run stopped
+    };
+
+    /**
+     * @brief Assigns Pareto ranks (0 = non-dominated) to rows of a cost matrix
+     * @param costs Row-major count x objectiveCount matrix, every objective minimized
+     * @param objectiveCount Objectives per row
+     * @param ranks Output rank per row
+     *
+     * Rows are visited in lexicographic order, so no row is dominated by a
+     * later one. Two objectives use the O(N log N) sweep (binary search over
+     * the last member of each front); more objectives use ENS-SS, which
+     * checks the fronts in order against their most recent members first.
+     * Identical rows share a rank.
+     */
+    void paretoRanks(const std::vector<double>& costs, size_t objectiveCount, std::vector<int>& ranks);
+
+    /**
+     * @brief Computes NSGA-II crowding distances of one front
+     * @param costs Row-major cost matrix (as for paretoRanks)
+     * @param objectiveCount Objectives per row
+     * @param front Rows of the front
+     * @param distances Output indexed by row (only the front's rows are written; boundaries are infinite)
+     */
+    void crowdingDistances(const std::vector<double>& costs, size_t objectiveCount, const std::vector<size_t>& front,
+                           std::vector<double>& distances);
+
+    /**
+     * @class MultiObjectiveGA
+     * @brief NSGA-II over several fitness functions of the same decoded value
+     *
+     * Each generation breeds populationSize offspring by crowded binary
+     * tournament, crossover and mutation, ranks parents and offspring
+     * together (fast non-dominated sort plus crowding distance) and keeps the
+     * best populationSize. Individuals live in a store of 2 x populationSize
+     * slots; offspring are bred into the slots the survivors left free, so
+     * survival copies no chromosomes. The non-dominated solutions of every
+     * generation are merged into an archive of at most paretoArchiveSize
+     * entries, pruned by repeatedly dropping the most crowded one.
+     *
+     * Every objective is optimized in its own direction
+     * (FitnessFunction::isMaximizationProblem); config.isMaximization,
+     * selectionType and elitismRate are not used. maxEvaluations and
+     * timeLimitSeconds are checked between generations, so maxEvaluations must
+     * be 0 or at least populationSize. A NaN objective value ranks as the
+     * worst possible value of that objective.
+     */
+    class MultiObjectiveGA {
+    public:
+        // Called after every generation with the first-front and archive sizes
+        using ProgressCallback = std::function<void(int generation, size_t frontSize, size_t archiveSize)>;
+
+    private:
+        GAConfig config;
+        std::vector<std::unique_ptr<FitnessFunction>> objectives;
+        std::vector<double> costSigns;             // +1 for minimized, -1 for maximized objectives
+        std::mt19937 rng;
+        std::unique_ptr<ThreadPool> evaluationPool; // Workers for evaluationThreads != 1
+
+        Population store;                          // 2 x populationSize slots
+        std::vector<double> values;                // Raw objective values per slot (row-major)
+        std::vector<double> positions;             // Decoded value per slot
+        std::vector<size_t> parents;               // Slots of the current population
+        std::vector<size_t> freeSlots;             // Slots offspring are bred into
+        std::vector<int> ranks;                    // Pareto rank per slot
+        std::vector<double> crowding;              // Crowding distance per slot
+
+        std::vector<size_t> rankedSlots;           // Scratch: slots being ranked
+        std::vector<double> costs;                 // Scratch: minimized costs of rankedSlots
+        std::vector<int> rowRanks;                 // Scratch: ranks of rankedSlots
+        std::vector<double> rowCrowding;           // Scratch: crowding of rankedSlots
+        std::vector<std::vector<size_t>> fronts;   // Scratch: rows per front
+        std::vector<double> batchInputs;           // Scratch: decoded values being evaluated
+        std::vector<double> batchOutputs;          // Scratch: objective values, one column per objective
+
+        std::vector<ParetoSolution> archive;       // Bounded non-dominated set
+        uint64_t evaluationCount;
+
+        void evaluateSlots(const std::vector<size_t>& slots);
+        void rankSlots(const std::vector<size_t>& slots);
+        size_t crowdedTournament();
+        std::pair<Individual, Individual> crossover(const Individual& parent1, const Individual& parent2);
+        void breedOffspring();
+        void selectSurvivors();
+        void updateArchive();
+        ThreadPool* getWorkerPool();
+
+    public:
+        /**
+         * @brief Creates the engine
+         * @param config Population, chromosome, operator, domain, budget and paretoArchiveSize parameters
+         * @param objectives Fitness functions optimized together (at least one)
+         */
+        MultiObjectiveGA(const GAConfig& config, std::vector<std::unique_ptr<FitnessFunction>> objectives);
+
+        /**
+         * @brief Runs NSGA-II for maxGenerations generations or until the budget runs out
+         * @param callback Optional per-generation progress callback
+         * @return Archived Pareto front and accounting
+         */
+        MultiObjectiveResult run(ProgressCallback callback = nullptr);
+
+        /**
+         * @brief Gets the archived non-dominated solutions of the last run
+         * @return Archive (unordered)
+         */
+        const std::vector<ParetoSolution>& getArchive() const;
+
+        /**
+         * @brief Gets the number of objectives
+         * @return Objective count
+         */
+        size_t getObjectiveCount() const;
+    };
+}
+
+#endif // MULTI_OBJECTIVE_H
@@ -0,0 +1,206 @@
+#include "Niching.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace GA {
+
+    // Decode positions, derive goodness and sort both orders
+    void Niching::prepare(const Population& population, const GAConfig& config) {
+        size_t count = population.size();
+        positions.resize(count);
+        goodness.resize(count);
+
+        FitnessValue worst = 0.0;
+        for (size_t i = 0; i < count; ++i) {
+            positions[i] = population[i].decodeToValue(config.minValue, config.maxValue);
+            FitnessValue fitness = population[i].getFitness();
+            if (i == 0 || (config.isMaximization ? fitness < worst : fitness > worst)) {
+                worst = fitness;
+            }
+        }
+        for (size_t i = 0; i < count; ++i) {
+            FitnessValue fitness = population[i].getFitness();
+            goodness[i] = config.isMaximization ? fitness - worst : worst - fitness;
+        }
+
+        byPosition.resize(count);
+        std::iota(byPosition.begin(), byPosition.end(), size_t(0));
+        std::sort(byPosition.begin(), byPosition.end(), [this](size_t a, size_t b) {
+            return positions[a] < positions[b] || (positions[a] == positions[b] && a < b);
+        });
+        rankOf.resize(count);
+        for (size_t rank = 0; rank < count; ++rank) {
+            rankOf[byPosition[rank]] = rank;
+        }
+    }
+
+    void Niching::compute(const Population& population, const GAConfig& config, std::vector<double>& nicheFitness) {
+        nicheFitness.resize(population.size());
+        if (population.empty()) {
+            return;
+        }
+
+        prepare(population, config);
+        if (config.niching == NichingType::CLEARING) {
+            clear(config.nicheRadius, config.nicheCapacity, nicheFitness);
+        } else if (config.niching == NichingType::FITNESS_SHARING) {
+            share(config, nicheFitness);
+        } else {
+            nicheFitness.assign(goodness.begin(), goodness.end());
+        }
+    }
+
+    // Shared fitness g / m with niche count m = sum of 1 - (d / radius)^alpha over the window
+    void Niching::share(const GAConfig& config, std::vector<double>& nicheFitness) {
+        size_t count = byPosition.size();
+        double radius = config.nicheRadius;
+        double alpha = config.sharingAlpha;
+
+        prefix.resize(count + 1);
+        prefix[0] = 0.0;
+        for (size_t rank = 0; rank < count; ++rank) {
+            prefix[rank + 1] = prefix[rank] + positions[byPosition[rank]];
+        }
+
+        size_t left = 0;
+        size_t right = 0;
+        for (size_t rank = 0; rank < count; ++rank) {
+            double x = positions[byPosition[rank]];
+            while (positions[byPosition[left]] <= x - radius) {
+                left++;
+            }
+            if (right < rank + 1) {
+                right = rank + 1;
+            }
+            while (right < count && positions[byPosition[right]] < x + radius) {
+                right++;
+            }
+
+            double nicheCount;
+            if (alpha == 1.0) {
+                // Sum of distances to the window from prefix sums
+                double below = (rank - left) * x - (prefix[rank] - prefix[left]);
+                double above = (prefix[right] - prefix[rank + 1]) - (right - rank - 1) * x;
+                nicheCount = (right - left) - (below + above) / radius;
+            } else {
+                nicheCount = 0.0;
+                for (size_t other = left; other < right; ++other) {
+                    nicheCount += 1.0 - std::pow(std::abs(positions[byPosition[other]] - x) / radius, alpha);
+                }
+            }
+
+            size_t slot = byPosition[rank];
+            nicheFitness[slot] = goodness[slot] / std::max(1.0, nicheCount);
+        }
+    }
+
+    // Next undecided rank at or right of rank (count = none)
+    size_t Niching::findRight(size_t rank) {
+        size_t root = rank;
+        while (root < nextRight.size() && nextRight[root] != root) {
+            root = nextRight[root];
+        }
+        while (rank < nextRight.size() && nextRight[rank] != rank) {
+            size_t next = nextRight[rank];
+            nextRight[rank] = root;
+            rank = next;
+        }
+        return root;
+    }
+
+    // Next undecided rank at or left of rank, shifted by one (0 = none)
+    size_t Niching::findLeft(size_t rank) {
+        size_t root = rank;
+        while (root > 0 && nextLeft[root - 1] != root) {
+            root = nextLeft[root - 1];
+        }
+        while (rank > 0 && nextLeft[rank - 1] != rank) {
+            size_t next = nextLeft[rank - 1];
+            nextLeft[rank - 1] = root;
+            rank = next;
+        }
+        return root;
+    }
+
+    // Clearing: best first, each winner keeps capacity individuals of its niche and clears the rest
+    void Niching::clear(double radius, int capacity, std::vector<double>& nicheFitness) {
+        size_t count = byPosition.size();
+        byGoodness.resize(count);
+        std::iota(byGoodness.begin(), byGoodness.end(), size_t(0));
+        std::sort(byGoodness.begin(), byGoodness.end(), [this](size_t a, size_t b) {
+            return goodness[a] > goodness[b] || (goodness[a] == goodness[b] && a < b);
+        });
+
+        // nextRight[r] == r and nextLeft[r] == r + 1 while rank r is undecided
+        nextRight.resize(count);
+        nextLeft.resize(count);
+        for (size_t rank = 0; rank < count; ++rank) {
+            nextRight[rank] = rank;
+            nextLeft[rank] = rank + 1;
+        }
+        auto decide = [this](size_t rank) {
+            nextRight[rank] = rank + 1;
+            nextLeft[rank] = rank;
+        };
+
+        nicheFitness.assign(count, 0.0);
+        winners.clear();
+        for (size_t slot : byGoodness) {
+            size_t rank = rankOf[slot];
+            if (nextRight[rank] != rank) {
+                continue;  // Cleared (or already a winner)
+            }
+            decide(rank);
+            winners.push_back(slot);
+            nicheFitness[slot] = goodness[slot];
+            double x = positions[slot];
+
+            // Undecided individuals within the radius, on both sides
+            neighbours.clear();
+            for (size_t other = findRight(rank + 1);
+                 other < count && positions[byPosition[other]] - x < radius; other = findRight(other + 1)) {
+                neighbours.push_back(other);
+                if (capacity == 1) {
+                    decide(other);
+                }
+            }
+            for (size_t other = findLeft(rank); other > 0 && x - positions[byPosition[other - 1]] < radius;
+                 other = findLeft(other - 1)) {
+                neighbours.push_back(other - 1);
+                if (capacity == 1) {
+                    decide(other - 1);
+                }
+            }
+            if (capacity == 1) {
+                continue;
+            }
+
+            // The best capacity - 1 neighbours stay undecided (they head their own niches later)
+            size_t kept = std::min(neighbours.size(), static_cast<size_t>(capacity - 1));
+            std::nth_element(neighbours.begin(), neighbours.begin() + kept, neighbours.end(),
+                             [this](size_t a, size_t b) {
+                                 size_t slotA = byPosition[a];
+                                 size_t slotB = byPosition[b];
+                                 return goodness[slotA] > goodness[slotB] ||
+                                        (goodness[slotA] == goodness[slotB] && slotA < slotB);
+                             });
+            for (size_t i = kept; i < neighbours.size(); ++i) {
+                decide(neighbours[i]);
+            }
+        }
+    }
+
+    std::vector<size_t> Niching::findPeaks(const Population& population, const GAConfig& config, double radius) {
+        std::vector<size_t> peaks;
+        if (population.empty()) {
+            return peaks;
+        }
+
+        std::vector<double> cleared(population.size());
+        prepare(population, config);
+        clear(radius, 1, cleared);
+        peaks.assign(winners.begin(), winners.end());
+        return peaks;
+    }
+}
@@ -0,0 +1,64 @@
+#ifndef NICHING_H
+#define NICHING_H
+
+#include "GeneticTypes.h"
+#include "Individual.h"
+#include <cstddef>
+#include <vector>
+
+namespace GA {
+    /**
+     * @class Niching
+     * @brief Niche-adjusted selection fitness (fitness sharing or clearing) in O(N log N)
+     *
+     * The phenotype is the decoded value, so neighbourhoods are found on the
+     * population sorted by x: everything within nicheRadius of an individual
+     * is a contiguous window of that order. Sharing with alpha = 1 sums the
+     * window with prefix sums; other alphas walk the window. Clearing visits
+     * individuals best first and skips already decided ones through
+     * path-compressed links, so each individual is cleared at most once.
+     *
+     * Results are "goodness" values (higher is better, 0 = worst or cleared)
+     * aligned with the population slots. Scratch buffers are kept between
+     * calls so no allocation happens once the population size is stable.
+     */
+    class Niching {
+    private:
+        std::vector<size_t> byPosition;            // Slots sorted by decoded value
+        std::vector<size_t> byGoodness;            // Slots sorted by goodness, best first
+        std::vector<size_t> rankOf;                // Position of each slot in byPosition
+        std::vector<double> positions;             // Decoded value per slot
+        std::vector<double> goodness;              // Raw goodness per slot
+        std::vector<double> prefix;                // Prefix sums of sorted positions
+        std::vector<size_t> nextRight;             // Skip links to the next undecided rank on each side
+        std::vector<size_t> nextLeft;
+        std::vector<size_t> neighbours;            // Undecided neighbours of the current winner
+        std::vector<size_t> winners;               // Niche winners of the last clearing, best first
+
+        void prepare(const Population& population, const GAConfig& config);
+        void share(const GAConfig& config, std::vector<double>& nicheFitness);
+        void clear(double radius, int capacity, std::vector<double>& nicheFitness);
+        size_t findRight(size_t rank);
+        size_t findLeft(size_t rank);
+
+    public:
+        /**
+         * @brief Computes the niche-adjusted fitness of every individual
+         * @param population Evaluated population
+         * @param config Configuration providing niching, nicheRadius, sharingAlpha, nicheCapacity, the domain and the direction
+         * @param nicheFitness Output goodness per slot (resized to the population size)
+         */
+        void compute(const Population& population, const GAConfig& config, std::vector<double>& nicheFitness);
+
+        /**
+         * @brief Finds the best individual of every niche (clearing with capacity 1)
+         * @param population Evaluated population
+         * @param config Configuration providing the domain and the direction
+         * @param radius Niche radius in decoded units
+         * @return Slots of the niche winners, best first
+         */
+        std::vector<size_t> findPeaks(const Population& population, const GAConfig& config, double radius);
+    };
+}
+
+#endif // NICHING_H
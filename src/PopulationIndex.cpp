@@ -0,0 +1,121 @@
+#include "PopulationIndex.h"
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
+
+namespace GA {
+
+    // Constructor
+    PopulationIndex::PopulationIndex()
+        : fitnessSum(0.0), fitnessCompensation(0.0), chromosomeLength(0), maximize(true) {
+    }
+
+    // Neumaier summation keeps the running sum accurate over many replacements
+    void PopulationIndex::addToSum(double value) {
+        double total = fitnessSum + value;
+        if (std::abs(fitnessSum) >= std::abs(value)) {
+            fitnessCompensation += (fitnessSum - total) + value;
+        } else {
+            fitnessCompensation += (value - total) + fitnessSum;
+        }
+        fitnessSum = total;
+    }
+
+    void PopulationIndex::addBits(const Individual& individual, int delta) {
+        const Chromosome& chromosome = individual.getChromosome();
+        for (size_t k = 0; k < chromosomeLength; ++k) {
+            if (chromosome[k]) {
+                onesPerBit[k] += delta;
+            }
+        }
+    }
+
+    void PopulationIndex::rebuild(const Population& population, bool maximizeFitness) {
+        clear();
+        maximize = maximizeFitness;
+        chromosomeLength = population.empty() ? 0 : population[0].getChromosome().size();
+        onesPerBit.assign(chromosomeLength, 0);
+
+        for (size_t slot = 0; slot < population.size(); ++slot) {
+            const Individual& individual = population[slot];
+            if (!individual.isFitnessValid()) {
+                throw std::runtime_error("Cannot index a population with unevaluated individuals");
+            }
+            order.emplace(individual.getFitness(), slot);
+            addToSum(individual.getFitness());
+            addBits(individual, 1);
+        }
+    }
+
+    void PopulationIndex::replace(Population& population, size_t slot, const Individual& replacement) {
+        Individual& current = population[slot];
+        auto entry = order.find(Entry(current.getFitness(), slot));
+        if (entry == order.end()) {
+            throw std::logic_error("Population index is out of sync with the population");
+        }
+        order.erase(entry);
+        addToSum(-current.getFitness());
+        addBits(current, -1);
+
+        current = replacement;
+
+        order.emplace(current.getFitness(), slot);
+        addToSum(current.getFitness());
+        addBits(current, 1);
+    }
+
+    size_t PopulationIndex::bestSlot() const {
+        return maximize ? order.rbegin()->second : order.begin()->second;
+    }
+
+    size_t PopulationIndex::worstSlot() const {
+        return maximize ? order.begin()->second : order.rbegin()->second;
+    }
+
+    size_t PopulationIndex::slotAtRank(size_t rank) const {
+        if (rank >= order.size()) {
+            rank = order.size() - 1;
+        }
+        return maximize ? std::next(order.rbegin(), rank)->second : std::next(order.begin(), rank)->second;
+    }
+
+    FitnessValue PopulationIndex::bestFitness() const {
+        return maximize ? order.rbegin()->first : order.begin()->first;
+    }
+
+    FitnessValue PopulationIndex::worstFitness() const {
+        return maximize ? order.begin()->first : order.rbegin()->first;
+    }
+
+    double PopulationIndex::averageFitness() const {
+        return order.empty() ? 0.0 : (fitnessSum + fitnessCompensation) / order.size();
+    }
+
+    double PopulationIndex::diversity() const {
+        if (order.size() < 2 || chromosomeLength == 0) {
+            return 0.0;
+        }
+
+        double count = static_cast<double>(order.size());
+        double differingPairs = 0.0;
+        for (uint32_t ones : onesPerBit) {
+            differingPairs += static_cast<double>(ones) * (count - ones);
+        }
+        return differingPairs / (count * (count - 1.0) / 2.0 * chromosomeLength);
+    }
+
+    size_t PopulationIndex::size() const {
+        return order.size();
+    }
+
+    bool PopulationIndex::empty() const {
+        return order.empty();
+    }
+
+    void PopulationIndex::clear() {
+        order.clear();
+        onesPerBit.clear();
+        fitnessSum = 0.0;
+        fitnessCompensation = 0.0;
+    }
+}
@@ -0,0 +1,88 @@
+#ifndef POPULATION_INDEX_H
+#define POPULATION_INDEX_H
+
+#include "GeneticTypes.h"
+#include "Individual.h"
+#include <cstdint>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace GA {
+    /**
+     * @class PopulationIndex
+     * @brief Incrementally maintained order and aggregates of a population
+     *
+     * Keeps individuals ordered by fitness (an order-statistics multiset of
+     * (fitness, slot) pairs), a compensated running fitness sum and per-bit one
+     * counts. Replacing one individual costs O(log N + L); best, worst and
+     * average fitness are O(1) and diversity is O(L).
+     */
+    class PopulationIndex {
+    private:
+        using Entry = std::pair<FitnessValue, size_t>;  // (fitness, population slot)
+
+        std::multiset<Entry> order;                // Individuals ordered by ascending fitness
+        std::vector<uint32_t> onesPerBit;          // Number of individuals with bit k set
+        double fitnessSum;                         // Running fitness sum
+        double fitnessCompensation;                // Lost low-order bits of the sum (Neumaier)
+        size_t chromosomeLength;                   // Bits per chromosome
+        bool maximize;                             // Whether higher fitness is better
+
+        void addToSum(double value);
+        void addBits(const Individual& individual, int delta);
+
+    public:
+        PopulationIndex();
+
+        /**
+         * @brief Rebuilds the index from a fully evaluated population in O(N log N + N·L)
+         * @param population Population to index
+         * @param maximize Optimization direction
+         */
+        void rebuild(const Population& population, bool maximize);
+
+        /**
+         * @brief Replaces the individual in a slot and updates the index
+         * @param population Population that owns the slot
+         * @param slot Slot to overwrite
+         * @param replacement Evaluated individual to store
+         */
+        void replace(Population& population, size_t slot, const Individual& replacement);
+
+        /**
+         * @brief Gets the slot holding the best individual
+         * @return Population slot
+         */
+        size_t bestSlot() const;
+
+        /**
+         * @brief Gets the slot holding the worst individual
+         * @return Population slot
+         */
+        size_t worstSlot() const;
+
+        /**
+         * @brief Gets the slot of the individual at a rank (0 = best)
+         * @param rank Rank counted from the best individual (O(rank))
+         * @return Population slot
+         */
+        size_t slotAtRank(size_t rank) const;
+
+        FitnessValue bestFitness() const;
+        FitnessValue worstFitness() const;
+        double averageFitness() const;
+
+        /**
+         * @brief Gets the mean pairwise Hamming distance per bit
+         * @return Diversity (0 = fully converged)
+         */
+        double diversity() const;
+
+        size_t size() const;
+        bool empty() const;
+        void clear();
+    };
+}
+
+#endif // POPULATION_INDEX_H
@@ -0,0 +1,265 @@
+#include "PopulationSnapshot.h"
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <stdexcept>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace GA {
+
+    namespace {
+        size_t alignUp(size_t value, size_t alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    }
+
+    // Build the whole file in memory and write it with one call
+    void PopulationSnapshot::write(const std::string& path, const Population& population,
+                                   const GAConfig& config, int generation) {
+        size_t count = population.size();
+        size_t chromosomeLength = population.empty() ? static_cast<size_t>(config.chromosomeLength)
+                                                     : population[0].getChromosomeLength();
+        size_t wordsPerIndividual = (chromosomeLength + 63) / 64;
+
+        PopulationSnapshotHeader header;
+        std::memset(&header, 0, sizeof(header));
+        header.magic = MAGIC;
+        header.version = VERSION;
+        header.individualCount = count;
+        header.chromosomeLength = static_cast<uint32_t>(chromosomeLength);
+        header.wordsPerIndividual = static_cast<uint32_t>(wordsPerIndividual);
+        header.generation = generation;
+        header.flags = config.isMaximization ? FLAG_MAXIMIZATION : 0u;
+        header.minValue = config.minValue;
+        header.maxValue = config.maxValue;
+        header.bitsOffset = alignUp(sizeof(header), COLUMN_ALIGNMENT);
+        header.fitnessOffset = alignUp(header.bitsOffset + count * wordsPerIndividual * sizeof(uint64_t), COLUMN_ALIGNMENT);
+        header.percentageOffset = alignUp(header.fitnessOffset + count * sizeof(double), COLUMN_ALIGNMENT);
+        size_t totalSize = header.percentageOffset + count * sizeof(double);
+
+        std::vector<unsigned char> buffer(totalSize, 0);
+        std::memcpy(buffer.data(), &header, sizeof(header));
+
+        uint64_t* bits = reinterpret_cast<uint64_t*>(buffer.data() + header.bitsOffset);
+        double* fitness = reinterpret_cast<double*>(buffer.data() + header.fitnessOffset);
+        double* percentage = reinterpret_cast<double*>(buffer.data() + header.percentageOffset);
+
+        for (size_t i = 0; i < count; ++i) {
+            const Individual& individual = population[i];
+            if (individual.getChromosomeLength() != chromosomeLength) {
+                throw std::invalid_argument("All individuals in a snapshot must have the same chromosome length");
+            }
+            individual.packChromosome(bits + i * wordsPerIndividual);
+            fitness[i] = individual.isFitnessValid() ? individual.getFitness()
+                                                     : std::numeric_limits<double>::quiet_NaN();
+            percentage[i] = individual.getFitnessPercentage();
+        }
+
+        FILE* file = std::fopen(path.c_str(), "wb");
+        if (!file) {
+            throw std::runtime_error("Cannot open population snapshot for writing: " + path);
+        }
+        size_t written = std::fwrite(buffer.data(), 1, buffer.size(), file);
+        bool closed = (std::fclose(file) == 0);
+        if (written != buffer.size() || !closed) {
+            throw std::runtime_error("Failed to write population snapshot: " + path);
+        }
+    }
+
+    // PopulationSnapshotReader implementation
+    PopulationSnapshotReader::PopulationSnapshotReader(const std::string& path)
+        : data(nullptr), mappedSize(0), header(nullptr), bits(nullptr),
+          fitnessColumn(nullptr), percentageColumn(nullptr) {
+        #ifdef _WIN32
+        fileHandle = nullptr;
+        mappingHandle = nullptr;
+
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Cannot open population snapshot: " + path);
+        }
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            CloseHandle(file);
+            throw std::runtime_error("Population snapshot is empty: " + path);
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            CloseHandle(file);
+            throw std::runtime_error("Cannot map population snapshot: " + path);
+        }
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            throw std::runtime_error("Cannot map population snapshot: " + path);
+        }
+        fileHandle = file;
+        mappingHandle = mapping;
+        data = static_cast<const unsigned char*>(view);
+        mappedSize = static_cast<size_t>(fileSize.QuadPart);
+        #else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open population snapshot: " + path);
+        }
+        struct stat fileStat;
+        if (::fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+            ::close(fd);
+            throw std::runtime_error("Population snapshot is empty: " + path);
+        }
+        void* view = ::mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);  // The mapping keeps the file referenced
+        if (view == MAP_FAILED) {
+            throw std::runtime_error("Cannot map population snapshot: " + path);
+        }
+        data = static_cast<const unsigned char*>(view);
+        mappedSize = static_cast<size_t>(fileStat.st_size);
+        #endif
+
+        // Validate the header and that every column lies inside the mapping
+        header = reinterpret_cast<const PopulationSnapshotHeader*>(data);
+        bool valid = mappedSize >= sizeof(PopulationSnapshotHeader) &&
+                     header->magic == PopulationSnapshot::MAGIC &&
+                     header->version == PopulationSnapshot::VERSION &&
+                     header->wordsPerIndividual == (header->chromosomeLength + 63) / 64;
+        if (valid) {
+            // Divide instead of multiplying so hostile counts cannot wrap around
+            uint64_t count = header->individualCount;
+            uint64_t rowBytes = static_cast<uint64_t>(header->wordsPerIndividual) * sizeof(uint64_t);
+            valid = header->bitsOffset % sizeof(uint64_t) == 0 &&
+                    header->fitnessOffset % sizeof(double) == 0 &&
+                    header->percentageOffset % sizeof(double) == 0 &&
+                    header->bitsOffset <= mappedSize &&
+                    header->fitnessOffset <= mappedSize &&
+                    header->percentageOffset <= mappedSize &&
+                    (rowBytes == 0 || count <= (mappedSize - header->bitsOffset) / rowBytes) &&
+                    count <= (mappedSize - header->fitnessOffset) / sizeof(double) &&
+                    count <= (mappedSize - header->percentageOffset) / sizeof(double);
+        }
+        if (!valid) {
+            unmap();
+            throw std::runtime_error("Not a valid population snapshot: " + path);
+        }
+
+        bits = reinterpret_cast<const uint64_t*>(data + header->bitsOffset);
+        fitnessColumn = reinterpret_cast<const double*>(data + header->fitnessOffset);
+        percentageColumn = reinterpret_cast<const double*>(data + header->percentageOffset);
+    }
+
+    PopulationSnapshotReader::~PopulationSnapshotReader() {
+        unmap();
+    }
+
+    void PopulationSnapshotReader::unmap() {
+        if (!data) {
+            return;
+        }
+        #ifdef _WIN32
+        UnmapViewOfFile(data);
+        CloseHandle(static_cast<HANDLE>(mappingHandle));
+        CloseHandle(static_cast<HANDLE>(fileHandle));
+        #else
+        ::munmap(const_cast<unsigned char*>(data), mappedSize);
+        #endif
+        data = nullptr;
+        header = nullptr;
+    }
+
+    size_t PopulationSnapshotReader::size() const {
+        return static_cast<size_t>(header->individualCount);
+    }
+
+    int PopulationSnapshotReader::getChromosomeLength() const {
+        return static_cast<int>(header->chromosomeLength);
+    }
+
+    int PopulationSnapshotReader::getGeneration() const {
+        return header->generation;
+    }
+
+    double PopulationSnapshotReader::getMinValue() const {
+        return header->minValue;
+    }
+
+    double PopulationSnapshotReader::getMaxValue() const {
+        return header->maxValue;
+    }
+
+    bool PopulationSnapshotReader::isMaximization() const {
+        return (header->flags & PopulationSnapshot::FLAG_MAXIMIZATION) != 0;
+    }
+
+    const uint64_t* PopulationSnapshotReader::getChromosomeWords(size_t index) const {
+        return bits + index * header->wordsPerIndividual;
+    }
+
+    bool PopulationSnapshotReader::getBit(size_t index, size_t bit) const {
+        const uint64_t* words = getChromosomeWords(index);
+        return ((words[bit / 64] >> (bit % 64)) & 1ULL) != 0;
+    }
+
+    FitnessValue PopulationSnapshotReader::getFitness(size_t index) const {
+        return fitnessColumn[index];
+    }
+
+    double PopulationSnapshotReader::getFitnessPercentage(size_t index) const {
+        return percentageColumn[index];
+    }
+
+    const double* PopulationSnapshotReader::getFitnessColumn() const {
+        return fitnessColumn;
+    }
+
+    const double* PopulationSnapshotReader::getPercentageColumn() const {
+        return percentageColumn;
+    }
+
+    // Same scaling as Individual::decodeToValue, reading the packed row directly
+    double PopulationSnapshotReader::decodeToValue(size_t index) const {
+        size_t length = header->chromosomeLength;
+        if (length == 0) {
+            return header->minValue;
+        }
+
+        const uint64_t* words = getChromosomeWords(index);
+        uint64_t binaryValue = 0;
+        for (size_t i = 0; i < length; ++i) {
+            if ((words[i / 64] >> (i % 64)) & 1ULL) {
+                binaryValue |= (1ULL << (length - 1 - i));
+            }
+        }
+
+        uint64_t maxBinaryValue = (1ULL << length) - 1;
+        return header->minValue + (static_cast<double>(binaryValue) / maxBinaryValue) * (header->maxValue - header->minValue);
+    }
+
+    Individual PopulationSnapshotReader::toIndividual(size_t index) const {
+        Individual individual;
+        individual.unpackChromosome(getChromosomeWords(index), header->chromosomeLength);
+        if (!std::isnan(fitnessColumn[index])) {
+            individual.setFitness(fitnessColumn[index]);
+        }
+        individual.setFitnessPercentage(percentageColumn[index]);
+        return individual;
+    }
+
+    PopulationSnapshotReader::Iterator PopulationSnapshotReader::begin() const {
+        return Iterator(this, 0);
+    }
+
+    PopulationSnapshotReader::Iterator PopulationSnapshotReader::end() const {
+        return Iterator(this, size());
+    }
+}
@@ -0,0 +1,197 @@
+#ifndef POPULATION_SNAPSHOT_H
+#define POPULATION_SNAPSHOT_H
+
+#include "GeneticTypes.h"
+#include "Individual.h"
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+
+namespace GA {
+    /**
+     * @struct PopulationSnapshotHeader
+     * @brief Fixed-size header at the start of a population snapshot file
+     *
+     * The header is followed by three 64-byte aligned columns: the bit matrix
+     * (wordsPerIndividual 64-bit words per individual, bit i of a chromosome in
+     * word i / 64 at position i % 64), the fitness column and the fitness
+     * percentage column (one double per individual each). Individuals whose
+     * fitness was never evaluated are stored with a NaN fitness.
+     */
+    struct PopulationSnapshotHeader {
+        uint32_t magic;                // PopulationSnapshot::MAGIC
+        uint32_t version;              // PopulationSnapshot::VERSION
+        uint64_t individualCount;      // Number of individuals
+        uint32_t chromosomeLength;     // Bits per chromosome
+        uint32_t wordsPerIndividual;   // 64-bit words per chromosome row
+        int32_t generation;            // Generation the population belongs to
+        uint32_t flags;                // Bit 0: maximization problem
+        double minValue;               // Domain minimum used for decoding
+        double maxValue;               // Domain maximum used for decoding
+        uint64_t bitsOffset;           // Byte offset of the bit matrix
+        uint64_t fitnessOffset;        // Byte offset of the fitness column
+        uint64_t percentageOffset;     // Byte offset of the fitness percentage column
+    };
+
+    /**
+     * @class PopulationSnapshot
+     * @brief Writes columnar population snapshots with a single large write
+     */
+    class PopulationSnapshot {
+    public:
+        static constexpr uint32_t MAGIC = 0x53504147;  // "GAPS" in little-endian order
+        static constexpr uint32_t VERSION = 1;
+        static constexpr uint32_t FLAG_MAXIMIZATION = 1u;
+        static constexpr size_t COLUMN_ALIGNMENT = 64;
+
+        /**
+         * @brief Writes a population snapshot
+         * @param path Destination file path
+         * @param population Population to write (unevaluated fitness is stored as NaN)
+         * @param config Configuration providing the decoding domain
+         * @param generation Generation number stored in the header
+         */
+        static void write(const std::string& path, const Population& population,
+                          const GAConfig& config, int generation);
+    };
+
+    /**
+     * @class PopulationSnapshotReader
+     * @brief Read-only, memory-mapped view of a population snapshot
+     *
+     * Individuals are accessed in place through the mapping; nothing is
+     * deserialized unless toIndividual() is called explicitly.
+     */
+    class PopulationSnapshotReader {
+    private:
+        const unsigned char* data;     // Start of the mapping
+        size_t mappedSize;             // Size of the mapping in bytes
+        const PopulationSnapshotHeader* header;
+        const uint64_t* bits;          // Bit matrix column
+        const double* fitnessColumn;   // Fitness column
+        const double* percentageColumn; // Fitness percentage column
+        #ifdef _WIN32
+        void* fileHandle;              // Windows file handle
+        void* mappingHandle;           // Windows file mapping handle
+        #endif
+
+        void unmap();
+
+    public:
+        /**
+         * @class IndividualView
+         * @brief Lightweight handle to one individual inside the mapping
+         */
+        class IndividualView {
+        private:
+            const PopulationSnapshotReader* reader;
+            size_t index;
+
+        public:
+            IndividualView(const PopulationSnapshotReader* reader, size_t index) : reader(reader), index(index) {}
+
+            size_t getIndex() const { return index; }
+            FitnessValue getFitness() const { return reader->getFitness(index); }
+            double getFitnessPercentage() const { return reader->getFitnessPercentage(index); }
+            bool getBit(size_t bit) const { return reader->getBit(index, bit); }
+            const uint64_t* getWords() const { return reader->getChromosomeWords(index); }
+            double decodeToValue() const { return reader->decodeToValue(index); }
+        };
+
+        /**
+         * @class Iterator
+         * @brief Forward iterator producing IndividualView handles
+         */
+        class Iterator {
+        private:
+            const PopulationSnapshotReader* reader;
+            size_t index;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = IndividualView;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = IndividualView;
+
+            Iterator(const PopulationSnapshotReader* reader, size_t index) : reader(reader), index(index) {}
+
+            IndividualView operator*() const { return IndividualView(reader, index); }
+            Iterator& operator++() { ++index; return *this; }
+            Iterator operator++(int) { Iterator previous = *this; ++index; return previous; }
+            bool operator==(const Iterator& other) const { return index == other.index; }
+            bool operator!=(const Iterator& other) const { return index != other.index; }
+        };
+
+        /**
+         * @brief Maps a snapshot file read-only and validates its header
+         * @param path Snapshot file written by PopulationSnapshot::write
+         */
+        explicit PopulationSnapshotReader(const std::string& path);
+        ~PopulationSnapshotReader();
+
+        PopulationSnapshotReader(const PopulationSnapshotReader&) = delete;
+        PopulationSnapshotReader& operator=(const PopulationSnapshotReader&) = delete;
+
+        // Header information
+        size_t size() const;
+        int getChromosomeLength() const;
+        int getGeneration() const;
+        double getMinValue() const;
+        double getMaxValue() const;
+        bool isMaximization() const;
+
+        // Column access (zero-copy)
+        /**
+         * @brief Gets the packed chromosome row of an individual
+         * @param index Individual index
+         * @return Pointer to wordsPerIndividual words inside the mapping
+         */
+        const uint64_t* getChromosomeWords(size_t index) const;
+
+        /**
+         * @brief Gets a single chromosome bit
+         * @param index Individual index
+         * @param bit Bit position (0 = most significant for decoding)
+         * @return The bit value
+         */
+        bool getBit(size_t index, size_t bit) const;
+
+        FitnessValue getFitness(size_t index) const;
+        double getFitnessPercentage(size_t index) const;
+
+        /**
+         * @brief Gets the whole fitness column
+         * @return Pointer to size() fitness values
+         */
+        const double* getFitnessColumn() const;
+
+        /**
+         * @brief Gets the whole fitness percentage column
+         * @return Pointer to size() percentage values
+         */
+        const double* getPercentageColumn() const;
+
+        /**
+         * @brief Decodes an individual straight from the mapped bits
+         * @param index Individual index
+         * @return Decoded value, identical to Individual::decodeToValue
+         */
+        double decodeToValue(size_t index) const;
+
+        /**
+         * @brief Materializes one individual (copies its chromosome and fitness)
+         *
+         * A NaN fitness leaves the individual unevaluated.
+         * @param index Individual index
+         * @return The deserialized individual
+         */
+        Individual toIndividual(size_t index) const;
+
+        Iterator begin() const;
+        Iterator end() const;
+    };
+}
+
+#endif // POPULATION_SNAPSHOT_H
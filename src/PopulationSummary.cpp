@@ -0,0 +1,103 @@
+#include "PopulationSummary.h"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace GA {
+    namespace {
+        // Best/worst/sum/best slot of [begin, end) (branch-free selects in the loop)
+        PopulationSummary reduceFitness(const Population& population, size_t begin, size_t end, bool maximize) {
+            PopulationSummary block;
+            block.count = end - begin;
+            block.bestFitness = population[begin].getFitness();
+            block.worstFitness = block.bestFitness;
+            block.bestIndex = begin;
+            
+            double sum = 0.0;
+            for (size_t i = begin; i < end; ++i) {
+                double fitness = population[i].getFitness();
+                sum += fitness;
+                bool better = maximize ? fitness > block.bestFitness : fitness < block.bestFitness;
+                bool worse = maximize ? fitness < block.worstFitness : fitness > block.worstFitness;
+                block.bestIndex = better ? i : block.bestIndex;
+                block.bestFitness = better ? fitness : block.bestFitness;
+                block.worstFitness = worse ? fitness : block.worstFitness;
+            }
+            block.fitnessSum = sum;
+            return block;
+        }
+        
+        // Write the percentages of [begin, end) and reduce them
+        void applyScale(Population& population, size_t begin, size_t end, const PercentageScale& scale,
+                        PopulationSummary& block) {
+            double sum = 0.0;
+            double best = 0.0;
+            for (size_t i = begin; i < end; ++i) {
+                double percentage = scale.apply(population[i].getFitness());
+                population[i].setFitnessPercentage(percentage);
+                sum += percentage;
+                best = std::max(best, percentage);
+            }
+            block.percentageSum = sum;
+            block.bestPercentage = best;
+        }
+        
+        // Run body over the blocks, in parallel when there is more than one
+        void forEachBlock(size_t blockCount, ThreadPool* pool, const ThreadPool::RangeFunction& body) {
+            if (pool && blockCount > 1) {
+                pool->parallelFor(blockCount, body, 1);
+            } else {
+                body(0, blockCount, 0);
+            }
+        }
+    }
+    
+    PopulationSummary summarizePopulation(Population& population, const FitnessFunction& fitnessFunction,
+                                          bool maximize, ThreadPool* pool) {
+        if (population.empty()) {
+            throw std::runtime_error("Cannot summarize an empty population");
+        }
+        
+        size_t size = population.size();
+        size_t blockCount = (size + SUMMARY_BLOCK - 1) / SUMMARY_BLOCK;
+        std::vector<PopulationSummary> blocks(blockCount);
+        
+        // Sweep 1: fitness aggregates per block
+        forEachBlock(blockCount, pool, [&](size_t first, size_t last, int) {
+            for (size_t b = first; b < last; ++b) {
+                blocks[b] = reduceFitness(population, b * SUMMARY_BLOCK, std::min(size, (b + 1) * SUMMARY_BLOCK), maximize);
+            }
+        });
+        
+        // Merge in slot order (a later block wins only if strictly better)
+        PopulationSummary summary = blocks[0];
+        for (size_t b = 1; b < blockCount; ++b) {
+            const PopulationSummary& block = blocks[b];
+            summary.count += block.count;
+            summary.fitnessSum += block.fitnessSum;
+            if (maximize ? block.bestFitness > summary.bestFitness : block.bestFitness < summary.bestFitness) {
+                summary.bestFitness = block.bestFitness;
+                summary.bestIndex = block.bestIndex;
+            }
+            if (maximize ? block.worstFitness < summary.worstFitness : block.worstFitness > summary.worstFitness) {
+                summary.worstFitness = block.worstFitness;
+            }
+        }
+        
+        // Sweep 2: percentages against the population's best and worst
+        PercentageScale scale = fitnessFunction.getPercentageScale(summary.bestFitness, summary.worstFitness);
+        forEachBlock(blockCount, pool, [&](size_t first, size_t last, int) {
+            for (size_t b = first; b < last; ++b) {
+                applyScale(population, b * SUMMARY_BLOCK, std::min(size, (b + 1) * SUMMARY_BLOCK), scale, blocks[b]);
+            }
+        });
+        
+        summary.percentageSum = 0.0;
+        summary.bestPercentage = 0.0;
+        for (const PopulationSummary& block : blocks) {
+            summary.percentageSum += block.percentageSum;
+            summary.bestPercentage = std::max(summary.bestPercentage, block.bestPercentage);
+        }
+        return summary;
+    }
+}
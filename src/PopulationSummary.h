@@ -0,0 +1,45 @@
+#ifndef POPULATION_SUMMARY_H
+#define POPULATION_SUMMARY_H
+
+#include "GeneticTypes.h"
+#include "Individual.h"
+#include "FitnessFunction.h"
+#include "ThreadPool.h"
+#include <cstddef>
+
+namespace GA {
+    const size_t SUMMARY_BLOCK = 1024;  // Individuals per reduction block
+    
+    /**
+     * @struct PopulationSummary
+     * @brief Fitness and percentage aggregates of an evaluated population
+     */
+    struct PopulationSummary {
+        size_t count = 0;               // Individuals summarized
+        FitnessValue bestFitness = 0.0; // Best fitness (first occurrence wins ties)
+        FitnessValue worstFitness = 0.0; // Worst fitness
+        double fitnessSum = 0.0;        // Sum of all fitness values
+        size_t bestIndex = 0;           // Population slot of bestFitness
+        double bestPercentage = 0.0;    // Highest fitness percentage
+        double percentageSum = 0.0;     // Sum of all fitness percentages
+    };
+    
+    /**
+     * @brief Computes best, worst, sum and best slot, then writes every fitness percentage
+     * @param population Evaluated, non-empty population (percentages are overwritten)
+     * @param fitnessFunction Function whose percentage scale is applied
+     * @param maximize Whether higher fitness is better
+     * @param pool Workers for large populations (nullptr = calling thread only)
+     * @return Aggregates of the population, percentages included
+     *
+     * Two sweeps: a reduction over the fitness values and one that applies the
+     * hoisted PercentageScale while reducing the percentages. Both work on
+     * fixed blocks of SUMMARY_BLOCK individuals merged in slot order, so the
+     * result does not depend on the number of threads, and a population of one
+     * block is summed exactly like a plain loop.
+     */
+    PopulationSummary summarizePopulation(Population& population, const FitnessFunction& fitnessFunction,
+                                          bool maximize, ThreadPool* pool = nullptr);
+}
+
+#endif // POPULATION_SUMMARY_H
@@ -0,0 +1,406 @@
+#include "ProcessFitnessFunction.h"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define GA_HAS_PROCESS_WORKERS 1
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <signal.h>
+    #include <sys/socket.h>
+    #include <sys/types.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
+namespace GA {
+
+#ifdef GA_HAS_PROCESS_WORKERS
+    namespace {
+        using Clock = std::chrono::steady_clock;
+
+        #ifdef MSG_NOSIGNAL
+        const int SEND_FLAGS = MSG_NOSIGNAL;       // A crashed worker must not raise SIGPIPE
+        #else
+        const int SEND_FLAGS = 0;                  // SO_NOSIGPIPE is set on the socket instead
+        #endif
+
+        int remainingMilliseconds(Clock::time_point deadline) {
+            if (deadline == Clock::time_point::max()) {
+                return -1;
+            }
+            long long remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+            return static_cast<int>(std::min<long long>(std::max<long long>(remaining, 0), INT_MAX));
+        }
+
+        // Send what the non-blocking socket accepts now (false on error or hang-up)
+        bool sendAvailable(int fd, const std::vector<char>& data, size_t& offset) {
+            while (offset < data.size()) {
+                ssize_t written = send(fd, data.data() + offset, data.size() - offset, SEND_FLAGS);
+                if (written < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    return errno == EAGAIN || errno == EWOULDBLOCK;
+                }
+                offset += static_cast<size_t>(written);
+            }
+            return true;
+        }
+
+        // Receive exactly length bytes before the deadline (false on error, EOF or timeout)
+        bool readFully(int fd, char* data, size_t length, Clock::time_point deadline) {
+            while (length > 0) {
+                pollfd entry{fd, POLLIN, 0};
+                int ready = poll(&entry, 1, remainingMilliseconds(deadline));
+                if (ready < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (ready <= 0) {
+                    return false;
+                }
+
+                ssize_t received = recv(fd, data, length, 0);
+                if (received < 0) {
+                    if (errno == EINTR || errno == EAGAIN) {
+                        continue;
+                    }
+                    return false;
+                }
+                if (received == 0) {
+                    return false;  // The worker closed its end
+                }
+                data += received;
+                length -= static_cast<size_t>(received);
+            }
+            return true;
+        }
+    }
+
+    // Constructor
+    ProcessFitnessFunction::ProcessFitnessFunction(const std::string& name, const std::string& expression,
+                                                   const ProcessWorkerOptions& options, bool maximize)
+        : FitnessFunction(name, expression, maximize), options(options), nextFrameId(0), restartCount(0) {
+        if (options.command.empty() || options.batchSize == 0 || options.pipelineDepth <= 0 ||
+            options.timeoutSeconds <= 0.0 || options.maxRetries < 0) {
+            throw std::invalid_argument("Invalid fitness worker options");
+        }
+
+        int count = options.workerCount > 0
+                        ? options.workerCount
+                        : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        workers.resize(count);
+        try {
+            for (Worker& worker : workers) {
+                startWorker(worker);
+            }
+        } catch (...) {
+            for (Worker& worker : workers) {
+                stopWorker(worker, true);
+            }
+            throw;
+        }
+    }
+
+    // Destructor: close every socket and give the workers a moment to exit on EOF
+    ProcessFitnessFunction::~ProcessFitnessFunction() {
+        for (Worker& worker : workers) {
+            stopWorker(worker, false);
+        }
+    }
+
+    // Spawn a worker with a socket pair as its standard input and output
+    void ProcessFitnessFunction::startWorker(Worker& worker) const {
+        int sockets[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0) {
+            throw std::runtime_error(std::string("Cannot create fitness worker socket: ") + std::strerror(errno));
+        }
+
+        // Reports an exec failure from the child (closed by a successful exec)
+        int status[2];
+        if (pipe(status) != 0) {
+            int error = errno;
+            close(sockets[0]);
+            close(sockets[1]);
+            throw std::runtime_error(std::string("Cannot create fitness worker pipe: ") + std::strerror(error));
+        }
+        fcntl(sockets[0], F_SETFD, FD_CLOEXEC);
+        fcntl(status[0], F_SETFD, FD_CLOEXEC);
+        fcntl(status[1], F_SETFD, FD_CLOEXEC);
+
+        // Built before fork: only async-signal-safe calls are allowed in the child
+        std::vector<char*> argv;
+        for (const std::string& argument : options.command) {
+            argv.push_back(const_cast<char*>(argument.c_str()));
+        }
+        argv.push_back(nullptr);
+
+        pid_t pid = fork();
+        if (pid < 0) {
+            int error = errno;
+            close(sockets[0]);
+            close(sockets[1]);
+            close(status[0]);
+            close(status[1]);
+            throw std::runtime_error(std::string("Cannot start fitness worker: ") + std::strerror(error));
+        }
+
+        if (pid == 0) {
+            dup2(sockets[1], STDIN_FILENO);
+            dup2(sockets[1], STDOUT_FILENO);
+            if (sockets[1] != STDIN_FILENO && sockets[1] != STDOUT_FILENO) {
+                close(sockets[1]);
+            }
+            execvp(argv[0], argv.data());
+
+            int error = errno;
+            ssize_t ignored = write(status[1], &error, sizeof(error));
+            (void)ignored;
+            _exit(127);
+        }
+
+        close(sockets[1]);
+        close(status[1]);
+
+        int execError = 0;
+        ssize_t received;
+        do {
+            received = read(status[0], &execError, sizeof(execError));
+        } while (received < 0 && errno == EINTR);
+        close(status[0]);
+
+        if (received == static_cast<ssize_t>(sizeof(execError))) {
+            close(sockets[0]);
+            waitpid(pid, nullptr, 0);
+            throw std::runtime_error("Cannot start fitness worker '" + options.command[0] + "': " +
+                                     std::strerror(execError));
+        }
+
+        #ifdef SO_NOSIGPIPE
+        int enabled = 1;
+        setsockopt(sockets[0], SOL_SOCKET, SO_NOSIGPIPE, &enabled, sizeof(enabled));
+        #endif
+        
+        // A frame larger than the socket buffer must not block the parent while the
+        // worker is itself blocked writing a reply (the deadline only applies to poll)
+        fcntl(sockets[0], F_SETFL, fcntl(sockets[0], F_GETFL) | O_NONBLOCK);
+
+        worker.pid = pid;
+        worker.socket = sockets[0];
+        worker.outstanding.clear();
+        worker.lastProgress = Clock::now();
+    }
+
+    // Close the connection and reap the process (killed at once when forced)
+    void ProcessFitnessFunction::stopWorker(Worker& worker, bool force) const {
+        if (worker.socket >= 0) {
+            close(worker.socket);
+            worker.socket = -1;
+        }
+
+        if (worker.pid > 0) {
+            bool exited = false;
+            if (!force) {
+                for (int attempt = 0; attempt < 100 && !exited; ++attempt) {
+                    exited = waitpid(worker.pid, nullptr, WNOHANG) == worker.pid;
+                    if (!exited) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    }
+                }
+            }
+            if (!exited) {
+                kill(worker.pid, SIGKILL);
+                waitpid(worker.pid, nullptr, 0);
+            }
+            worker.pid = -1;
+        }
+        worker.outstanding.clear();
+        worker.pending.clear();
+        worker.pendingOffset = 0;
+    }
+
+    // Requeue the frames of a failed worker and replace the process
+    void ProcessFitnessFunction::recoverWorker(Worker& worker, std::vector<Frame>& frames, std::deque<size_t>& queue,
+                                               const std::string& reason) const {
+        for (size_t frame : worker.outstanding) {
+            if (++frames[frame].failures > options.maxRetries) {
+                throw std::runtime_error("Fitness worker " + reason + " (frame failed " +
+                                         std::to_string(frames[frame].failures) + " times)");
+            }
+        }
+
+        queue.insert(queue.begin(), worker.outstanding.begin(), worker.outstanding.end());
+        stopWorker(worker, true);
+        restartCount++;
+        startWorker(worker);
+    }
+
+    // Split the batch into frames and pipeline them over the workers
+    void ProcessFitnessFunction::evaluateBatch(const double* x, FitnessValue* fitness, size_t count) const {
+        if (count == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+
+        std::vector<Frame> frames;
+        for (size_t offset = 0; offset < count; offset += options.batchSize) {
+            frames.push_back({offset, static_cast<uint32_t>(std::min(options.batchSize, count - offset)), 0});
+        }
+        std::deque<size_t> queue(frames.size());
+        std::iota(queue.begin(), queue.end(), size_t(0));
+
+        uint32_t firstFrameId = nextFrameId;
+        nextFrameId += static_cast<uint32_t>(frames.size());
+        Clock::duration timeout = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(options.timeoutSeconds));
+
+        std::vector<pollfd> polls;
+        std::vector<size_t> polled;
+        size_t answered = 0;
+
+        try {
+            while (answered < frames.size()) {
+                // Keep every worker pipeline full (one partly sent request per worker at a time)
+                for (Worker& worker : workers) {
+                    while (worker.pendingOffset == worker.pending.size() &&
+                           worker.outstanding.size() < static_cast<size_t>(options.pipelineDepth) && !queue.empty()) {
+                        size_t frame = queue.front();
+                        uint32_t header[2] = {firstFrameId + static_cast<uint32_t>(frame), frames[frame].count};
+                        size_t payload = frames[frame].count * sizeof(double);
+                        worker.pending.resize(sizeof(header) + payload);
+                        worker.pendingOffset = 0;
+                        std::memcpy(worker.pending.data(), header, sizeof(header));
+                        std::memcpy(worker.pending.data() + sizeof(header), x + frames[frame].offset, payload);
+
+                        if (worker.outstanding.empty()) {
+                            worker.lastProgress = Clock::now();
+                        }
+                        queue.pop_front();
+                        worker.outstanding.push_back(frame);
+                        if (!sendAvailable(worker.socket, worker.pending, worker.pendingOffset)) {
+                            recoverWorker(worker, frames, queue, "stopped accepting requests");
+                            break;
+                        }
+                    }
+                }
+
+                // Wait for a reply, room for the rest of a request, or the earliest timeout
+                polls.clear();
+                polled.clear();
+                Clock::time_point earliest = Clock::time_point::max();
+                for (size_t w = 0; w < workers.size(); ++w) {
+                    if (!workers[w].outstanding.empty()) {
+                        short events = POLLIN;
+                        if (workers[w].pendingOffset < workers[w].pending.size()) {
+                            events |= POLLOUT;
+                        }
+                        polls.push_back({workers[w].socket, events, 0});
+                        polled.push_back(w);
+                        earliest = std::min(earliest, workers[w].lastProgress + timeout);
+                    }
+                }
+                int ready = poll(polls.data(), polls.size(), remainingMilliseconds(earliest));
+                if (ready < 0 && errno != EINTR) {
+                    throw std::runtime_error(std::string("Waiting for fitness workers failed: ") + std::strerror(errno));
+                }
+
+                for (size_t k = 0; k < polls.size(); ++k) {
+                    Worker& worker = workers[polled[k]];
+                    if (polls[k].revents == 0) {
+                        if (Clock::now() >= worker.lastProgress + timeout) {
+                            recoverWorker(worker, frames, queue, "timed out");
+                        }
+                        continue;
+                    }
+
+                    if (polls[k].revents & POLLOUT) {
+                        size_t sentBefore = worker.pendingOffset;
+                        if (!sendAvailable(worker.socket, worker.pending, worker.pendingOffset)) {
+                            recoverWorker(worker, frames, queue, "stopped accepting requests");
+                            continue;
+                        }
+                        if (worker.pendingOffset > sentBefore) {
+                            worker.lastProgress = Clock::now();
+                        }
+                    }
+                    if (!(polls[k].revents & (POLLIN | POLLERR | POLLHUP | POLLNVAL))) {
+                        continue;
+                    }
+
+                    uint32_t header[2];
+                    Clock::time_point deadline = Clock::now() + timeout;
+                    if (!readFully(worker.socket, reinterpret_cast<char*>(header), sizeof(header), deadline)) {
+                        recoverWorker(worker, frames, queue, "exited or closed its connection");
+                        continue;
+                    }
+
+                    size_t frame = static_cast<uint32_t>(header[0] - firstFrameId);
+                    auto position = std::find(worker.outstanding.begin(), worker.outstanding.end(), frame);
+                    if (position == worker.outstanding.end() || header[1] != frames[frame].count) {
+                        recoverWorker(worker, frames, queue, "sent a malformed reply");
+                        continue;
+                    }
+                    if (!readFully(worker.socket, reinterpret_cast<char*>(fitness + frames[frame].offset),
+                                   frames[frame].count * sizeof(double), deadline)) {
+                        recoverWorker(worker, frames, queue, "sent a truncated reply");
+                        continue;
+                    }
+
+                    worker.outstanding.erase(position);
+                    worker.lastProgress = Clock::now();
+                    answered++;
+                }
+            }
+        } catch (...) {
+            // Replies still owed for this batch would be mistaken for the next one
+            for (Worker& worker : workers) {
+                if (!worker.outstanding.empty()) {
+                    stopWorker(worker, true);
+                    startWorker(worker);
+                }
+            }
+            throw;
+        }
+    }
+
+#else
+    ProcessFitnessFunction::ProcessFitnessFunction(const std::string& name, const std::string& expression,
+                                                   const ProcessWorkerOptions& options, bool maximize)
+        : FitnessFunction(name, expression, maximize), options(options), nextFrameId(0), restartCount(0) {
+        throw std::runtime_error("Out-of-process fitness workers require a POSIX system");
+    }
+
+    ProcessFitnessFunction::~ProcessFitnessFunction() = default;
+
+    void ProcessFitnessFunction::evaluateBatch(const double*, FitnessValue*, size_t) const {
+        throw std::runtime_error("Out-of-process fitness workers require a POSIX system");
+    }
+#endif
+
+    double ProcessFitnessFunction::evaluate(double x) const {
+        FitnessValue fitness = 0.0;
+        evaluateBatch(&x, &fitness, 1);
+        return fitness;
+    }
+
+    size_t ProcessFitnessFunction::getPreferredBatchSize() const {
+        return options.batchSize * workers.size() * static_cast<size_t>(options.pipelineDepth);
+    }
+
+    std::unique_ptr<FitnessFunction> ProcessFitnessFunction::clone() const {
+        return std::make_unique<ProcessFitnessFunction>(functionName, functionExpression, options, isMaximization);
+    }
+
+    int ProcessFitnessFunction::getWorkerCount() const {
+        return static_cast<int>(workers.size());
+    }
+
+    uint64_t ProcessFitnessFunction::getRestartCount() const {
+        return restartCount;
+    }
+}
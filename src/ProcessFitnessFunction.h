@@ -0,0 +1,127 @@
+#ifndef PROCESS_FITNESS_FUNCTION_H
+#define PROCESS_FITNESS_FUNCTION_H
+
+#include "FitnessFunction.h"
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace GA {
+    /**
+     * @struct ProcessWorkerOptions
+     * @brief How external fitness workers are started and supervised
+     */
+    struct ProcessWorkerOptions {
+        std::vector<std::string> command;   // Worker executable followed by its arguments (looked up in PATH)
+        int workerCount = 0;                // Worker processes (0 = hardware concurrency)
+        size_t batchSize = 64;              // Values per request frame
+        int pipelineDepth = 2;              // Request frames in flight per worker
+        double timeoutSeconds = 30.0;       // Longest wait for a reply before the worker is restarted
+        int maxRetries = 1;                 // Times a frame is resent after its worker timed out or crashed
+    };
+
+    /**
+     * @class ProcessFitnessFunction
+     * @brief Evaluates fitness in external worker processes
+     *
+     * Each worker runs with one end of a Unix socket pair as its standard input
+     * and output, and answers request frames with reply frames (native byte order):
+     *
+     *   request: uint32 frameId, uint32 count, count x double (decoded x values)
+     *   reply:   uint32 frameId, uint32 count, count x double (fitness values)
+     *
+     * Replies may arrive in any order. A worker should exit when its input
+     * reaches end of file. A batch is split into frames spread over all workers,
+     * with up to pipelineDepth frames queued per worker. Workers that time out,
+     * crash or send malformed replies are killed and restarted, and their
+     * outstanding frames are resent.
+     *
+     * Calls are serialized internally, so keep GAConfig::evaluationThreads at 1;
+     * the worker processes provide the parallelism. POSIX only (the constructor
+     * throws std::runtime_error elsewhere).
+     */
+    class ProcessFitnessFunction : public FitnessFunction {
+    private:
+        struct Worker {
+            int pid = -1;                          // Process id (-1 = not running)
+            int socket = -1;                       // Parent end of the socket pair
+            std::deque<size_t> outstanding;        // Frames sent and not yet answered (batch-local indices)
+            std::vector<char> pending;             // Request bytes not yet accepted by the socket
+            size_t pendingOffset = 0;              // Bytes of pending already sent
+            std::chrono::steady_clock::time_point lastProgress;  // Last send or reply
+        };
+
+        // One request frame of the batch being evaluated
+        struct Frame {
+            size_t offset;                         // First value of the frame within the batch
+            uint32_t count;                        // Number of values
+            int failures;                          // Worker failures while this frame was outstanding
+        };
+
+        ProcessWorkerOptions options;
+        mutable std::vector<Worker> workers;
+        mutable std::mutex mutex;                  // Serializes evaluateBatch callers
+        mutable uint32_t nextFrameId;              // Frame id of the first frame of the next batch
+        mutable uint64_t restartCount;             // Workers restarted after a failure
+
+        void startWorker(Worker& worker) const;
+        void stopWorker(Worker& worker, bool force) const;
+
+        /**
+         * @brief Handles a failed worker: requeues its frames and restarts it
+         * @param worker The failed worker
+         * @param frames Frames of the current batch
+         * @param queue Frames waiting to be sent
+         * @param reason Description used if a frame exceeds maxRetries
+         */
+        void recoverWorker(Worker& worker, std::vector<Frame>& frames, std::deque<size_t>& queue,
+                           const std::string& reason) const;
+
+    public:
+        /**
+         * @brief Starts the worker processes
+         * @param name Function name (identifies checkpoints)
+         * @param expression Expression shown to the user (identifies checkpoints)
+         * @param options Worker command and supervision settings
+         * @param maximize Optimization direction
+         */
+        ProcessFitnessFunction(const std::string& name, const std::string& expression,
+                               const ProcessWorkerOptions& options, bool maximize = true);
+        ~ProcessFitnessFunction() override;
+
+        ProcessFitnessFunction(const ProcessFitnessFunction&) = delete;
+        ProcessFitnessFunction& operator=(const ProcessFitnessFunction&) = delete;
+
+        double evaluate(double x) const override;
+        void evaluateBatch(const double* x, FitnessValue* fitness, size_t count) const override;
+
+        /**
+         * @brief Gets a batch size that fills every worker pipeline
+         * @return batchSize * workers * pipelineDepth
+         */
+        size_t getPreferredBatchSize() const override;
+
+        /**
+         * @brief Creates a copy with its own worker processes
+         * @return A new ProcessFitnessFunction with the same options
+         */
+        std::unique_ptr<FitnessFunction> clone() const override;
+
+        /**
+         * @brief Gets the number of worker processes
+         * @return Worker count
+         */
+        int getWorkerCount() const;
+
+        /**
+         * @brief Gets how many times a worker was restarted after a failure
+         * @return Restart count
+         */
+        uint64_t getRestartCount() const;
+    };
+}
+
+#endif // PROCESS_FITNESS_FUNCTION_H
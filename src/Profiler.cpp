@@ -0,0 +1,134 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace GA {
+
+    const char* profilePhaseName(ProfilePhase phase) {
+        switch (phase) {
+            case ProfilePhase::SORT: return "Sort";
+            case ProfilePhase::ELITE_SELECTION: return "Elite selection";
+            case ProfilePhase::PARENT_SELECTION: return "Parent selection";
+            case ProfilePhase::CROSSOVER: return "Crossover";
+            case ProfilePhase::MUTATION: return "Mutation";
+            case ProfilePhase::EVALUATION: return "Evaluation";
+            case ProfilePhase::STATISTICS: return "Statistics";
+            case ProfilePhase::CONVERGENCE_CHECK: return "Convergence check";
+            case ProfilePhase::REPLACEMENT: return "Replacement";
+            case ProfilePhase::BREEDING: return "Parallel breeding";
+            case ProfilePhase::REFINEMENT: return "Domain refinement";
+            case ProfilePhase::LOCAL_SEARCH: return "Local search";
+            case ProfilePhase::NICHING: return "Niching";
+            default: return "Unknown";
+        }
+    }
+
+    const char* profileCounterName(ProfileCounter counter) {
+        switch (counter) {
+            case ProfileCounter::EVALUATIONS: return "Evaluations";
+            case ProfileCounter::ALLOCATIONS: return "Allocations";
+            case ProfileCounter::CACHE_HITS: return "Cache hits";
+            default: return "Unknown";
+        }
+    }
+
+    // Calibrate the cycle counter against steady_clock once
+    double ProfileClock::nanosecondsPerTick() {
+        #ifdef GA_PROFILER_HAS_RDTSC
+        static const double factor = [] {
+            auto wallStart = std::chrono::steady_clock::now();
+            uint64_t tickStart = now();
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            uint64_t tickEnd = now();
+            auto wallEnd = std::chrono::steady_clock::now();
+
+            double nanoseconds = static_cast<double>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(wallEnd - wallStart).count());
+            return (tickEnd > tickStart) ? nanoseconds / static_cast<double>(tickEnd - tickStart) : 1.0;
+        }();
+        return factor;
+        #else
+        return 1.0;
+        #endif
+    }
+
+    double PhaseProfile::percentileNanoseconds(double fraction) const {
+        if (calls == 0) {
+            return 0.0;
+        }
+
+        uint64_t rank = static_cast<uint64_t>(std::ceil(fraction * calls));
+        uint64_t cumulative = 0;
+        for (int bucket = 0; bucket < HISTOGRAM_BUCKETS; ++bucket) {
+            cumulative += histogram[bucket];
+            if (cumulative >= rank) {
+                return std::min(maxNanoseconds, std::ldexp(1.0, bucket + 1));
+            }
+        }
+        return maxNanoseconds;
+    }
+
+    void GAProfile::recordPhase(ProfilePhase phase, uint64_t ticks) {
+        PhaseProfile& entry = phases[static_cast<size_t>(phase)];
+        double nanoseconds = ticks * ProfileClock::nanosecondsPerTick();
+
+        if (entry.calls == 0 || nanoseconds < entry.minNanoseconds) {
+            entry.minNanoseconds = nanoseconds;
+        }
+        if (nanoseconds > entry.maxNanoseconds) {
+            entry.maxNanoseconds = nanoseconds;
+        }
+        entry.calls++;
+        entry.totalNanoseconds += nanoseconds;
+
+        // log2 bucket of the duration
+        int bucket = 0;
+        uint64_t whole = static_cast<uint64_t>(nanoseconds);
+        while (whole > 1 && bucket < PhaseProfile::HISTOGRAM_BUCKETS - 1) {
+            whole >>= 1;
+            bucket++;
+        }
+        entry.histogram[bucket]++;
+    }
+
+    void GAProfile::recordPhaseHardware(ProfilePhase phase, const HardwareCounterValues& counts) {
+        phases[static_cast<size_t>(phase)].hardware += counts;
+        hardwareCollected = true;
+    }
+
+    const PhaseProfile& GAProfile::getPhase(ProfilePhase phase) const {
+        return phases[static_cast<size_t>(phase)];
+    }
+
+    uint64_t GAProfile::getCounter(ProfileCounter counter) const {
+        return counters[static_cast<size_t>(counter)];
+    }
+
+    double GAProfile::getTotalNanoseconds() const {
+        double total = 0.0;
+        for (const PhaseProfile& phase : phases) {
+            total += phase.totalNanoseconds;
+        }
+        return total;
+    }
+
+    bool GAProfile::hasHardwareCounters() const {
+        return hardwareCollected;
+    }
+
+    void GAProfile::setHardwareUnavailableReason(const std::string& reason) {
+        hardwareUnavailableReason = reason;
+    }
+
+    const std::string& GAProfile::getHardwareUnavailableReason() const {
+        return hardwareUnavailableReason;
+    }
+
+    void GAProfile::reset() {
+        phases = {};
+        counters = {};
+        hardwareCollected = false;
+        hardwareUnavailableReason.clear();
+    }
+}
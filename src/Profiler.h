@@ -0,0 +1,234 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "HardwareCounters.h"
+#include <array>
+#include <cstdint>
+#include <chrono>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+    #define GA_PROFILER_HAS_RDTSC 1
+#endif
+
+/**
+ * @file Profiler.h
+ * @brief Low-overhead per-phase instrumentation for the genetic algorithm
+ *
+ * Phases are timed with rdtsc where available (steady_clock otherwise) and,
+ * optionally, measured with hardware counters. Define GA_DISABLE_PROFILING at compile time to remove every timer and
+ * counter from the hot path.
+ */
+
+namespace GA {
+    /**
+     * @brief Phases of a generation that are timed separately
+     */
+    enum class ProfilePhase {
+        SORT,
+        ELITE_SELECTION,
+        PARENT_SELECTION,
+        CROSSOVER,
+        MUTATION,
+        EVALUATION,
+        STATISTICS,
+        CONVERGENCE_CHECK,
+        REPLACEMENT,
+        BREEDING,
+        REFINEMENT,
+        LOCAL_SEARCH,
+        NICHING,
+        COUNT
+    };
+
+    /**
+     * @brief Event counters collected alongside the phase timers
+     */
+    enum class ProfileCounter {
+        EVALUATIONS,        // Fitness function evaluations
+        ALLOCATIONS,        // Chromosome buffers allocated (individuals constructed or copied)
+        CACHE_HITS,         // Individuals whose fitness was reused instead of re-evaluated
+        COUNT
+    };
+
+    /**
+     * @brief Gets a printable phase name
+     * @param phase The phase
+     * @return Phase name
+     */
+    const char* profilePhaseName(ProfilePhase phase);
+
+    /**
+     * @brief Gets a printable counter name
+     * @param counter The counter
+     * @return Counter name
+     */
+    const char* profileCounterName(ProfileCounter counter);
+
+    /**
+     * @class ProfileClock
+     * @brief Cycle counter (rdtsc) or steady_clock ticks with a calibrated ns conversion
+     */
+    class ProfileClock {
+    public:
+        static inline uint64_t now() {
+            #ifdef GA_PROFILER_HAS_RDTSC
+            return __rdtsc();
+            #else
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+            #endif
+        }
+
+        /**
+         * @brief Gets the tick-to-nanosecond factor (calibrated once on first use)
+         * @return Nanoseconds per tick
+         */
+        static double nanosecondsPerTick();
+    };
+
+    /**
+     * @struct PhaseProfile
+     * @brief Aggregated timings of one phase
+     */
+    struct PhaseProfile {
+        static const int HISTOGRAM_BUCKETS = 32;   // Bucket b counts durations in [2^b, 2^(b+1)) ns
+
+        uint64_t calls = 0;                        // Number of timed sections
+        double totalNanoseconds = 0.0;             // Sum of all durations
+        double minNanoseconds = 0.0;               // Shortest duration
+        double maxNanoseconds = 0.0;               // Longest duration
+        std::array<uint64_t, HISTOGRAM_BUCKETS> histogram{};  // log2 duration histogram
+        HardwareCounterValues hardware;            // Summed hardware counts (when collected)
+
+        /**
+         * @brief Estimates a percentile from the histogram
+         * @param fraction Percentile in [0, 1]
+         * @return Upper bound of the bucket holding the percentile (ns)
+         */
+        double percentileNanoseconds(double fraction) const;
+    };
+
+    /**
+     * @class GAProfile
+     * @brief Per-phase totals, histograms and event counters of a run
+     */
+    class GAProfile {
+    private:
+        std::array<PhaseProfile, static_cast<size_t>(ProfilePhase::COUNT)> phases;
+        std::array<uint64_t, static_cast<size_t>(ProfileCounter::COUNT)> counters{};
+        bool hardwareCollected = false;            // Whether any phase carries hardware counts
+        std::string hardwareUnavailableReason;     // Why requested hardware counters were not collected
+
+    public:
+        /**
+         * @brief Adds one timed section to a phase
+         * @param phase The phase
+         * @param ticks Duration in ProfileClock ticks
+         */
+        void recordPhase(ProfilePhase phase, uint64_t ticks);
+        
+        /**
+         * @brief Adds hardware counts of one timed section to a phase
+         * @param phase The phase
+         * @param counts Counter difference over the section
+         */
+        void recordPhaseHardware(ProfilePhase phase, const HardwareCounterValues& counts);
+
+        /**
+         * @brief Increments an event counter
+         * @param counter The counter
+         * @param amount Amount to add
+         */
+        void addCounter(ProfileCounter counter, uint64_t amount) {
+            counters[static_cast<size_t>(counter)] += amount;
+        }
+
+        const PhaseProfile& getPhase(ProfilePhase phase) const;
+        uint64_t getCounter(ProfileCounter counter) const;
+
+        /**
+         * @brief Gets the summed time of all phases
+         * @return Total instrumented time in nanoseconds
+         */
+        double getTotalNanoseconds() const;
+
+        /**
+         * @brief Checks whether phases carry hardware counter data
+         * @return True if hardware counters were collected
+         */
+        bool hasHardwareCounters() const;
+
+        /**
+         * @brief Notes that hardware counters were requested but could not be opened
+         * @param reason Explanation shown with the profile
+         */
+        void setHardwareUnavailableReason(const std::string& reason);
+        const std::string& getHardwareUnavailableReason() const;
+
+        /**
+         * @brief Clears all phases and counters
+         */
+        void reset();
+    };
+
+    /**
+     * @class ScopedPhaseTimer
+     * @brief Times the enclosing scope into a GAProfile phase
+     */
+    class ScopedPhaseTimer {
+    private:
+        GAProfile& profile;
+        ProfilePhase phase;
+        const HardwareCounters* hardware;          // Counters to sample (nullptr = time only)
+        HardwareCounterValues hardwareStart;
+        uint64_t start;
+
+    public:
+        ScopedPhaseTimer(GAProfile& profile, ProfilePhase phase, const HardwareCounters* hardware = nullptr)
+            : profile(profile), phase(phase), hardware(hardware) {
+            if (hardware) {
+                hardwareStart = hardware->read();
+            }
+            start = ProfileClock::now();
+        }
+
+        ~ScopedPhaseTimer() {
+            uint64_t end = ProfileClock::now();
+            if (hardware) {
+                profile.recordPhaseHardware(phase, hardware->read() - hardwareStart);
+            }
+            profile.recordPhase(phase, end - start);
+        }
+
+        ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+        ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+    };
+
+    // Per-thread count of chromosome allocations (read as deltas by the engine)
+    inline thread_local uint64_t profileAllocationCount = 0;
+}
+
+#define GA_PROFILE_CONCAT_INNER(a, b) a##b
+#define GA_PROFILE_CONCAT(a, b) GA_PROFILE_CONCAT_INNER(a, b)
+
+#ifndef GA_DISABLE_PROFILING
+    #define GA_PROFILE_PHASE(profile, phase) \
+        ::GA::ScopedPhaseTimer GA_PROFILE_CONCAT(profileTimer_, __LINE__)((profile), (phase))
+    #define GA_PROFILE_PHASE_COUNTERS(profile, phase, hardware) \
+        ::GA::ScopedPhaseTimer GA_PROFILE_CONCAT(profileTimer_, __LINE__)((profile), (phase), (hardware))
+    #define GA_PROFILE_COUNT(profile, counter, amount) (profile).addCounter((counter), (amount))
+    #define GA_PROFILE_ALLOCATION() (++::GA::profileAllocationCount)
+#else
+    #define GA_PROFILE_PHASE(profile, phase) ((void)0)
+    #define GA_PROFILE_PHASE_COUNTERS(profile, phase, hardware) ((void)0)
+    #define GA_PROFILE_COUNT(profile, counter, amount) ((void)0)
+    #define GA_PROFILE_ALLOCATION() ((void)0)
+#endif
+
+#endif // PROFILER_H
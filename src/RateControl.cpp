@@ -0,0 +1,81 @@
+#include "RateControl.h"
+#include <algorithm>
+#include <cmath>
+
+namespace GA {
+    namespace {
+        // Fraction of successful offspring at which the 1/5th rule keeps the rate
+        const double TARGET_SUCCESS_RATIO = 0.2;
+
+        double interpolate(double initial, double final, double progress, bool exponential) {
+            if (exponential && initial > 0.0 && final > 0.0) {
+                return initial * std::pow(final / initial, progress);
+            }
+            return initial + (final - initial) * progress;
+        }
+    }
+
+    // ScheduledRateController implementation
+    ScheduledRateController::ScheduledRateController(const GAConfig& config, bool exponential)
+        : exponential(exponential), finalMutationRate(config.finalMutationRate),
+          finalCrossoverRate(config.finalCrossoverRate) {
+    }
+
+    OperatorRates ScheduledRateController::update(const RateFeedback& feedback) {
+        double progress = std::min(1.0, static_cast<double>(feedback.generation) / feedback.maxGenerations);
+        return OperatorRates{interpolate(feedback.initial.mutationRate, finalMutationRate, progress, exponential),
+                             interpolate(feedback.initial.crossoverRate, finalCrossoverRate, progress, exponential)};
+    }
+
+    // DiversityRateController implementation
+    DiversityRateController::DiversityRateController(const GAConfig& config)
+        : targetDiversity(config.targetDiversity), factor(config.rateAdaptationFactor),
+          minMutationRate(config.minMutationRate), maxMutationRate(config.maxMutationRate) {
+    }
+
+    OperatorRates DiversityRateController::update(const RateFeedback& feedback) {
+        double rate = feedback.current.mutationRate;
+        rate = feedback.stats.convergence < targetDiversity ? rate * factor : rate / factor;
+        return OperatorRates{std::max(minMutationRate, std::min(maxMutationRate, rate)), feedback.current.crossoverRate};
+    }
+
+    // SuccessRuleRateController implementation
+    SuccessRuleRateController::SuccessRuleRateController(const GAConfig& config)
+        : factor(config.rateAdaptationFactor), minMutationRate(config.minMutationRate),
+          maxMutationRate(config.maxMutationRate) {
+    }
+
+    OperatorRates SuccessRuleRateController::update(const RateFeedback& feedback) {
+        double rate = feedback.current.mutationRate;
+        if (feedback.successRatio > TARGET_SUCCESS_RATIO) {
+            rate *= factor;
+        } else if (feedback.successRatio < TARGET_SUCCESS_RATIO) {
+            rate /= factor;
+        }
+        return OperatorRates{std::max(minMutationRate, std::min(maxMutationRate, rate)), feedback.current.crossoverRate};
+    }
+
+    // SelfAdaptiveRateController implementation
+    OperatorRates SelfAdaptiveRateController::update(const RateFeedback& feedback) {
+        double rate = feedback.meanSelfAdaptiveRate > 0.0 ? feedback.meanSelfAdaptiveRate : feedback.current.mutationRate;
+        return OperatorRates{rate, feedback.current.crossoverRate};
+    }
+
+    // Built-in controller for the configured rate control
+    std::unique_ptr<RateController> createRateController(const GAConfig& config) {
+        switch (config.rateControl) {
+            case RateControlType::LINEAR_SCHEDULE:
+                return std::make_unique<ScheduledRateController>(config, false);
+            case RateControlType::EXPONENTIAL_SCHEDULE:
+                return std::make_unique<ScheduledRateController>(config, true);
+            case RateControlType::DIVERSITY_FEEDBACK:
+                return std::make_unique<DiversityRateController>(config);
+            case RateControlType::ONE_FIFTH_SUCCESS:
+                return std::make_unique<SuccessRuleRateController>(config);
+            case RateControlType::SELF_ADAPTIVE:
+                return std::make_unique<SelfAdaptiveRateController>();
+            default:
+                return nullptr;
+        }
+    }
+}
@@ -0,0 +1,131 @@
+#ifndef RATE_CONTROL_H
+#define RATE_CONTROL_H
+
+#include "GeneticTypes.h"
+#include <memory>
+
+namespace GA {
+    /**
+     * @struct OperatorRates
+     * @brief Mutation and crossover probabilities used for one generation
+     */
+    struct OperatorRates {
+        double mutationRate;                       // Probability of flipping each bit
+        double crossoverRate;                      // Probability of recombining a pair of parents
+    };
+
+    /**
+     * @struct RateFeedback
+     * @brief What a rate controller observes after each generation
+     *
+     * Everything is gathered by the engine while the generation runs, so
+     * controllers update in O(1).
+     */
+    struct RateFeedback {
+        const GenerationStats& stats;              // Statistics of the generation just completed
+        int generation;                            // Generation number
+        int maxGenerations;                        // Generation limit of the run
+        OperatorRates initial;                     // Rates the run started with
+        OperatorRates current;                     // Rates used for this generation
+        double successRatio;                       // Offspring fitter than their better parent (ONE_FIFTH_SUCCESS, else 0)
+        double meanSelfAdaptiveRate;               // Mean rate carried by the population (SELF_ADAPTIVE, else 0)
+    };
+
+    /**
+     * @class RateController
+     * @brief Base class for policies that adjust the operator rates between generations
+     *
+     * update() is called once per generation after its statistics are known;
+     * the returned rates are used by the next generation. The engine keeps the
+     * current rates in GAConfig, so controllers derive everything from the
+     * feedback and checkpoints resume exactly.
+     */
+    class RateController {
+    public:
+        virtual ~RateController() = default;
+
+        /**
+         * @brief Computes the rates of the next generation
+         * @param feedback Observations of the generation just completed
+         * @return New rates (clamped to [0, 1] by the engine)
+         */
+        virtual OperatorRates update(const RateFeedback& feedback) = 0;
+    };
+
+    /**
+     * @class ScheduledRateController
+     * @brief Moves both rates from their initial to their final values over maxGenerations
+     *
+     * LINEAR_SCHEDULE interpolates linearly, EXPONENTIAL_SCHEDULE geometrically
+     * (linearly where a rate starts or ends at zero).
+     */
+    class ScheduledRateController : public RateController {
+    private:
+        bool exponential;
+        double finalMutationRate;
+        double finalCrossoverRate;
+
+    public:
+        ScheduledRateController(const GAConfig& config, bool exponential);
+        OperatorRates update(const RateFeedback& feedback) override;
+    };
+
+    /**
+     * @class DiversityRateController
+     * @brief Raises the mutation rate while diversity is below a target and lowers it above
+     *
+     * Uses the generation's convergence value (mean per-bit Hamming distance).
+     */
+    class DiversityRateController : public RateController {
+    private:
+        double targetDiversity;
+        double factor;                             // Multiplier per generation
+        double minMutationRate;
+        double maxMutationRate;
+
+    public:
+        explicit DiversityRateController(const GAConfig& config);
+        OperatorRates update(const RateFeedback& feedback) override;
+    };
+
+    /**
+     * @class SuccessRuleRateController
+     * @brief Rechenberg's 1/5th success rule applied to the mutation rate
+     *
+     * More than a fifth of the offspring beating their better parent means
+     * the search is too conservative, so the mutation rate grows; fewer means
+     * it shrinks.
+     */
+    class SuccessRuleRateController : public RateController {
+    private:
+        double factor;                             // Multiplier per generation
+        double minMutationRate;
+        double maxMutationRate;
+
+    public:
+        explicit SuccessRuleRateController(const GAConfig& config);
+        OperatorRates update(const RateFeedback& feedback) override;
+    };
+
+    /**
+     * @class SelfAdaptiveRateController
+     * @brief Reports the population's mean self-adaptive mutation rate as the global rate
+     *
+     * Each individual carries and mutates its own rate (see
+     * GeneticAlgorithm::performMutation); the global rate seeds individuals
+     * that have none, such as random newcomers after a domain refinement.
+     */
+    class SelfAdaptiveRateController : public RateController {
+    public:
+        OperatorRates update(const RateFeedback& feedback) override;
+    };
+
+    /**
+     * @brief Creates the built-in controller selected by config.rateControl
+     * @param config Configuration providing the rate control parameters
+     * @return Controller, or nullptr for CONSTANT
+     */
+    std::unique_ptr<RateController> createRateController(const GAConfig& config);
+}
+
+#endif // RATE_CONTROL_H
@@ -0,0 +1,218 @@
+#include "RestartDriver.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+namespace GA {
+    namespace {
+        // Largest population a restart may grow to
+        const double MAX_RESTART_POPULATION = 1 << 24;
+
+        // Seed of restart r (restart 0 keeps the base seed)
+        unsigned int restartSeed(unsigned int baseSeed, int restart) {
+            if (restart == 0) {
+                return baseSeed;
+            }
+            std::seed_seq sequence{baseSeed, static_cast<unsigned int>(restart)};
+            uint32_t seed = 0;
+            sequence.generate(&seed, &seed + 1);
+            return seed != 0 ? seed : 1;
+        }
+
+        // Ends a concurrent restart once another one has reached the target
+        class StopFlagCriterion : public StoppingCriterion {
+        private:
+            const std::atomic<bool>& stopRequested;
+
+        public:
+            explicit StopFlagCriterion(const std::atomic<bool>& stopRequested) : stopRequested(stopRequested) {
+            }
+
+            bool shouldStop(const StoppingContext& /*context*/) override {
+                return stopRequested.load(std::memory_order_relaxed);
+            }
+
+            std::string describe() const override {
+                return "Another restart reached the target fitness";
+            }
+        };
+    }
+
+    // Constructor
+    RestartDriver::RestartDriver(const GAConfig& config, std::unique_ptr<FitnessFunction> fitnessFunction)
+        : config(config), fitnessFunction(std::move(fitnessFunction)),
+          criterionFactory([] { return std::make_unique<DiversityCriterion>(0.01); }), targetTolerance(1e-6),
+          hasBest(false), nextRestart(0), finished(false), reservedEvaluations(0), idleSlots(0),
+          stopRequested(false) {
+        if (!this->fitnessFunction) {
+            throw std::invalid_argument("Fitness function cannot be null");
+        }
+        if (config.maxRestarts < 0 || config.restartPopulationGrowth < 1.0 || config.concurrentRestarts < 0) {
+            throw std::invalid_argument("Invalid restart parameters");
+        }
+
+        int slots = config.concurrentRestarts > 0
+                        ? config.concurrentRestarts
+                        : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        slots = std::min(slots, config.maxRestarts + 1);
+        for (int slot = 0; slot < slots; ++slot) {
+            engines.push_back(std::make_unique<GeneticAlgorithm>(config, this->fitnessFunction->clone()));
+        }
+    }
+
+    void RestartDriver::setCriterionFactory(CriterionFactory factory) {
+        if (!factory) {
+            throw std::invalid_argument("Criterion factory cannot be null");
+        }
+        criterionFactory = std::move(factory);
+    }
+
+    void RestartDriver::setTargetTolerance(double tolerance) {
+        targetTolerance = tolerance;
+    }
+
+    int RestartDriver::populationForRestart(int restart) const {
+        double size = config.populationSize * std::pow(config.restartPopulationGrowth, restart);
+        return static_cast<int>(std::max(2.0, std::min(MAX_RESTART_POPULATION, std::round(size))));
+    }
+
+    // Run restarts sequentially or on every slot at once
+    RestartResult RestartDriver::run() {
+        sequenceStart = std::chrono::steady_clock::now();
+
+        // Target fitness of the whole sequence, derived as TargetFitnessCriterion does
+        TargetFitnessCriterion target(targetTolerance);
+        target.begin(config, *fitnessFunction);
+        double targetFitness = target.getTarget();
+        unsigned int baseSeed = config.randomSeed != 0 ? config.randomSeed : std::random_device{}();
+
+        result = RestartResult();
+        hasBest = false;
+        nextRestart = 0;
+        finished = false;
+        reservedEvaluations = 0;
+        idleSlots = static_cast<int>(engines.size());
+        stopRequested.store(false);
+
+        if (engines.size() == 1) {
+            runSlot(0, baseSeed, targetFitness);
+        } else {
+            ThreadPool pool(static_cast<int>(engines.size()));
+            pool.parallelFor(engines.size(), [&](size_t begin, size_t end, int) {
+                for (size_t slot = begin; slot < end; ++slot) {
+                    runSlot(slot, baseSeed, targetFitness);
+                }
+            });
+        }
+
+        std::sort(result.history.begin(), result.history.end(),
+                  [](const RestartRecord& a, const RestartRecord& b) { return a.restart < b.restart; });
+        result.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - sequenceStart).count();
+        if (result.terminationReason.empty()) {
+            result.terminationReason = "Restart limit reached";
+        }
+        return result;
+    }
+
+    // Launch restarts on one engine until the sequence is finished
+    void RestartDriver::runSlot(size_t slot, unsigned int baseSeed, double targetFitness) {
+        GeneticAlgorithm& engine = *engines[slot];
+
+        while (true) {
+            GAConfig restartConfig = config;
+            int restart;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (finished || nextRestart > config.maxRestarts) {
+                    finished = true;
+                    return;
+                }
+
+                // Split what is left of the sequence budget between the idle slots
+                double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - sequenceStart).count();
+                uint64_t committed = result.evaluations + reservedEvaluations;
+                uint64_t share = 0;
+                if (config.maxEvaluations > 0) {
+                    share = committed < config.maxEvaluations ? (config.maxEvaluations - committed) / idleSlots : 0;
+                }
+                if ((config.maxEvaluations > 0 && share == 0) ||
+                    (config.timeLimitSeconds > 0.0 && elapsedSeconds >= config.timeLimitSeconds)) {
+                    finished = true;
+                    result.terminationReason = "Compute limit reached";
+                    return;
+                }
+
+                restartConfig.maxEvaluations = share;
+                if (config.timeLimitSeconds > 0.0) {
+                    restartConfig.timeLimitSeconds = config.timeLimitSeconds - elapsedSeconds;
+                }
+                reservedEvaluations += share;
+                restart = nextRestart++;
+                idleSlots--;
+            }
+
+            restartConfig.populationSize = populationForRestart(restart);
+            restartConfig.randomSeed = restartSeed(baseSeed, restart);
+            restartConfig.checkpointInterval = 0;  // Restarts would overwrite each other's checkpoints
+            if (engines.size() > 1) {
+                restartConfig.evaluationThreads = 1;
+                restartConfig.traceOutputPath.clear();
+            }
+
+            std::unique_ptr<AnyOfCriterion> criterion = std::make_unique<AnyOfCriterion>();
+            criterion->add(criterionFactory());
+            if (!std::isnan(targetFitness)) {
+                criterion->add(std::make_unique<TargetFitnessCriterion>(targetFitness, targetTolerance));
+                if (engines.size() > 1) {
+                    criterion->add(std::make_unique<StopFlagCriterion>(stopRequested));
+                }
+            }
+            engine.updateConfig(restartConfig);
+            engine.setStoppingCriterion(std::move(criterion));
+            GenerationStats stats = engine.run();
+
+            const RunSummary& summary = engine.getRunSummary();
+            Individual best = engine.getBestSoFar();
+            RestartRecord record;
+            record.restart = restart;
+            record.populationSize = restartConfig.populationSize;
+            record.generations = stats.generation;
+            record.evaluations = summary.evaluations;
+            record.bestFitness = best.getFitness();
+            record.bestValue = best.decodeToValue(engine.getConfig().minValue, engine.getConfig().maxValue);
+            record.terminationReason = summary.terminationReason;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            idleSlots++;
+            reservedEvaluations -= restartConfig.maxEvaluations;
+            result.evaluations += summary.evaluations;
+            result.restarts++;
+            result.history.push_back(record);
+
+            bool better = !hasBest || (config.isMaximization ? record.bestFitness > result.bestFitness
+                                                            : record.bestFitness < result.bestFitness);
+            if (better) {
+                result.best = best;
+                result.bestFitness = record.bestFitness;
+                result.bestValue = record.bestValue;
+                hasBest = true;
+            }
+
+            double slack = targetTolerance * std::max(1.0, std::abs(targetFitness));
+            if (!std::isnan(targetFitness) && (config.isMaximization ? result.bestFitness >= targetFitness - slack
+                                                                     : result.bestFitness <= targetFitness + slack)) {
+                result.targetReached = true;
+                if (!finished) {
+                    result.terminationReason = "Target fitness reached in restart " + std::to_string(restart);
+                }
+                finished = true;
+                stopRequested.store(true);
+            }
+        }
+    }
+}
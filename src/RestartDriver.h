@@ -0,0 +1,122 @@
+#ifndef RESTART_DRIVER_H
+#define RESTART_DRIVER_H
+
+#include "GeneticTypes.h"
+#include "Individual.h"
+#include "FitnessFunction.h"
+#include "GeneticAlgorithm.h"
+#include "StoppingCriteria.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace GA {
+    /**
+     * @struct RestartRecord
+     * @brief Outcome of one restart
+     */
+    struct RestartRecord {
+        int restart = 0;                           // Restart index (0 = first run)
+        int populationSize = 0;                    // Population size of this restart
+        int generations = 0;                       // Generations completed
+        uint64_t evaluations = 0;                  // Fitness evaluations used
+        FitnessValue bestFitness = 0.0;            // Best fitness found by this restart
+        double bestValue = 0.0;                    // Decoded value of that individual
+        std::string terminationReason;             // Why this restart stopped
+    };
+
+    /**
+     * @struct RestartResult
+     * @brief Global best and accounting of a restart sequence
+     */
+    struct RestartResult {
+        Individual best;                           // Best individual over all restarts
+        FitnessValue bestFitness = 0.0;            // Its fitness
+        double bestValue = 0.0;                    // Its decoded value
+        int restarts = 0;                          // Restarts run (including the first)
+        uint64_t evaluations = 0;                  // Fitness evaluations over all restarts
+        double wallSeconds = 0.0;                  // Wall time of the sequence
+        bool targetReached = false;                // True if the global best reached the target fitness
+        std::string terminationReason;             // Why the sequence stopped
+        std::vector<RestartRecord> history;        // One record per restart, in restart order
+    };
+
+    /**
+     * @class RestartDriver
+     * @brief Re-runs the genetic algorithm with growing populations until the target is reached (IPOP)
+     *
+     * Restart r uses populationSize * restartPopulationGrowth^r individuals and
+     * a seed derived from (randomSeed, r). A restart ends when its stopping
+     * criterion fires (default: diversity below 0.01, i.e. hasConverged()) or
+     * the target fitness is reached; the sequence ends at the target, after
+     * maxRestarts restarts, or when maxEvaluations / timeLimitSeconds, which
+     * here bound the whole sequence, run out.
+     *
+     * Each of the concurrentRestarts slots owns one engine that is reused for
+     * every restart it runs, so population buffers, worker threads and the
+     * fitness function's memoized theoretical range carry over. With more than
+     * one slot, restarts run side by side with one evaluation thread each and
+     * the remaining budget is split between the slots as they launch;
+     * sequences are only reproducible with one slot. Once one restart reaches
+     * the target, the others stop at the end of their current generation.
+     */
+    class RestartDriver {
+    public:
+        // Creates the per-restart stopping criterion
+        using CriterionFactory = std::function<std::unique_ptr<StoppingCriterion>()>;
+
+    private:
+        GAConfig config;                           // Base configuration (population size of restart 0)
+        std::unique_ptr<FitnessFunction> fitnessFunction;  // Prototype cloned into each engine
+        std::vector<std::unique_ptr<GeneticAlgorithm>> engines;  // One per slot, reused across restarts
+        CriterionFactory criterionFactory;         // Per-restart termination
+        double targetTolerance;                    // Relative tolerance of the target fitness
+
+        std::mutex mutex;                          // Guards everything below during a sequence
+        RestartResult result;
+        bool hasBest;
+        int nextRestart;                           // Next restart index to launch
+        bool finished;                             // Set once no further restart may launch
+        uint64_t reservedEvaluations;              // Budget handed to running restarts
+        int idleSlots;                             // Slots not running a restart
+        std::chrono::steady_clock::time_point sequenceStart;  // Start of the current sequence (time limit)
+        std::atomic<bool> stopRequested;           // Set at the target; running restarts stop after their generation
+
+        int populationForRestart(int restart) const;
+        void runSlot(size_t slot, unsigned int baseSeed, double targetFitness);
+
+    public:
+        /**
+         * @brief Creates a driver
+         * @param config Configuration of the first run plus maxRestarts, restartPopulationGrowth and concurrentRestarts
+         * @param fitnessFunction Objective (cloned for every slot)
+         */
+        RestartDriver(const GAConfig& config, std::unique_ptr<FitnessFunction> fitnessFunction);
+
+        /**
+         * @brief Sets the criterion that ends each restart (the target check is always added)
+         * @param factory Called once per restart
+         */
+        void setCriterionFactory(CriterionFactory factory);
+
+        /**
+         * @brief Sets the relative tolerance of the target fitness (default 1e-6)
+         * @param tolerance Tolerance scaled by max(1, |target|)
+         *
+         * The target is derived from the fitness function as in TargetFitnessCriterion.
+         */
+        void setTargetTolerance(double tolerance);
+
+        /**
+         * @brief Runs restarts until the target, the restart limit or the budget is reached
+         * @return Global best and per-restart records
+         */
+        RestartResult run();
+    };
+}
+
+#endif // RESTART_DRIVER_H
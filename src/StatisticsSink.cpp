@@ -0,0 +1,420 @@
+#include "StatisticsSink.h"
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+#include <filesystem>
+#include <stdexcept>
+
+namespace GA {
+
+    // StatisticsSink implementation
+    StatisticsSink::StatisticsSink(size_t retainLimit)
+        : retainLimit(retainLimit), firstEntry(), hasFirstEntry(false), recentHead(0),
+          recordedCount(0), retainedViewDirty(true) {
+        if (retainLimit > 0) {
+            recent.reserve(retainLimit);
+        }
+    }
+
+    void StatisticsSink::begin(bool /*resuming*/) {
+        clear();
+    }
+
+    void StatisticsSink::record(const GenerationStats& stats) {
+        retain(stats);
+        write(stats);
+    }
+
+    void StatisticsSink::restore(const std::vector<GenerationStats>& history) {
+        clear();
+        for (const GenerationStats& stats : history) {
+            retain(stats);
+        }
+    }
+
+    void StatisticsSink::clear() {
+        hasFirstEntry = false;
+        recent.clear();
+        recentHead = 0;
+        recordedCount = 0;
+        retainedViewDirty = true;
+    }
+
+    void StatisticsSink::flush() {
+        // Nothing buffered for in-memory sinks
+    }
+
+    void StatisticsSink::write(const GenerationStats& /*stats*/) {
+        // In-memory sinks only retain
+    }
+
+    // Keep the first entry plus the most recent retainLimit entries
+    void StatisticsSink::retain(const GenerationStats& stats) {
+        ++recordedCount;
+        retainedViewDirty = true;
+
+        if (!hasFirstEntry) {
+            firstEntry = stats;
+            hasFirstEntry = true;
+            return;
+        }
+
+        if (retainLimit == 0 || recent.size() < retainLimit) {
+            recent.push_back(stats);
+        } else {
+            recent[recentHead] = stats;
+            recentHead = (recentHead + 1) % retainLimit;
+        }
+    }
+
+    const std::vector<GenerationStats>& StatisticsSink::getRetained() const {
+        if (retainedViewDirty) {
+            retainedView.clear();
+            if (hasFirstEntry) {
+                retainedView.reserve(recent.size() + 1);
+                retainedView.push_back(firstEntry);
+                for (size_t i = 0; i < recent.size(); ++i) {
+                    retainedView.push_back(recent[(recentHead + i) % recent.size()]);
+                }
+            }
+            retainedViewDirty = false;
+        }
+        return retainedView;
+    }
+
+    const GenerationStats& StatisticsSink::last() const {
+        if (!hasFirstEntry) {
+            throw std::runtime_error("No generation statistics have been recorded");
+        }
+        if (recent.empty()) {
+            return firstEntry;
+        }
+        return recent[(recentHead + recent.size() - 1) % recent.size()];
+    }
+
+    bool StatisticsSink::empty() const {
+        return !hasFirstEntry;
+    }
+
+    size_t StatisticsSink::getRecordedCount() const {
+        return recordedCount;
+    }
+
+    // InMemoryStatisticsSink implementation
+    InMemoryStatisticsSink::InMemoryStatisticsSink() : StatisticsSink(0) {
+    }
+
+    // RingBufferStatisticsSink implementation
+    RingBufferStatisticsSink::RingBufferStatisticsSink(size_t capacity)
+        : StatisticsSink(capacity > 0 ? capacity : 1) {
+    }
+
+    // FileStatisticsSink implementation
+    FileStatisticsSink::FileStatisticsSink(const std::string& path, size_t retainLimit, int flushIntervalMs)
+        : StatisticsSink(retainLimit > 0 ? retainLimit : 1), path(path),
+          flushIntervalMs(flushIntervalMs > 0 ? flushIntervalMs : 200), file(nullptr),
+          writing(false), stopping(false) {
+        flusher = std::thread(&FileStatisticsSink::flusherLoop, this);
+    }
+
+    FileStatisticsSink::~FileStatisticsSink() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+        flusher.join();
+        closeFile();
+    }
+
+    void FileStatisticsSink::begin(bool resuming) {
+        StatisticsSink::begin(resuming);
+        closeFile();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            writeError = nullptr;
+        }
+
+        // A fresh run truncates the file; a resumed run keeps appending to it
+        openFile(resuming);
+    }
+
+    // Cut the entries written after the checkpoint, then reopen for appending
+    void FileStatisticsSink::restore(const std::vector<GenerationStats>& history) {
+        StatisticsSink::restore(history);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (history.empty() || !file) {
+                return;
+            }
+        }
+        closeFile();
+
+        long keep = 0;
+        FILE* input = std::fopen(path.c_str(), "rb");
+        if (input) {
+            keep = findResumeOffset(input, history.back().generation);
+            std::fclose(input);
+        }
+
+        std::error_code error;
+        std::filesystem::resize_file(path, static_cast<std::uintmax_t>(keep), error);
+        if (error) {
+            throw std::runtime_error("Cannot truncate statistics file: " + path);
+        }
+        openFile(true);
+    }
+
+    void FileStatisticsSink::openFile(bool append) {
+        const char* mode = append ? (isBinary() ? "ab" : "a") : (isBinary() ? "wb" : "w");
+        FILE* opened = std::fopen(path.c_str(), mode);
+        if (!opened) {
+            throw std::runtime_error("Cannot open statistics file: " + path);
+        }
+
+        std::fseek(opened, 0, SEEK_END);
+        bool isEmpty = (std::ftell(opened) == 0);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        file = opened;
+        pendingBuffer.clear();
+        if (isEmpty) {
+            encodeHeader(pendingBuffer);
+        }
+    }
+
+    void FileStatisticsSink::write(const GenerationStats& stats) {
+        std::lock_guard<std::mutex> lock(mutex);
+        encodeEntry(stats, pendingBuffer);
+
+        // Wake the flusher early if a lot of data has accumulated
+        if (pendingBuffer.size() >= (1u << 20)) {
+            condition.notify_all();
+        }
+    }
+
+    void FileStatisticsSink::flush() {
+        std::unique_lock<std::mutex> lock(mutex);
+        writePending(lock);
+        if (writeError) {
+            std::exception_ptr error = writeError;
+            writeError = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    // Text entries: one per line, generation first; a partial last line is dropped
+    long FileStatisticsSink::findResumeOffset(FILE* input, int generation) const {
+        long keep = 0;
+        long offset = 0;
+        std::string line;
+        int c;
+        while ((c = std::fgetc(input)) != EOF) {
+            ++offset;
+            if (c != '\n') {
+                line += static_cast<char>(c);
+                continue;
+            }
+
+            size_t start = 0;
+            while (start < line.size() && !std::isdigit(static_cast<unsigned char>(line[start])) &&
+                   line[start] != '-') {
+                ++start;
+            }
+            if (start < line.size() && std::strtol(line.c_str() + start, nullptr, 10) > generation) {
+                break;
+            }
+            keep = offset;
+            line.clear();
+        }
+        return keep;
+    }
+
+    const std::string& FileStatisticsSink::getPath() const {
+        return path;
+    }
+
+    void FileStatisticsSink::flusherLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stopping) {
+            condition.wait_for(lock, std::chrono::milliseconds(flushIntervalMs));
+            writePending(lock);
+        }
+        writePending(lock);
+    }
+
+    // Swap out the pending buffer and write it without holding the lock
+    void FileStatisticsSink::writePending(std::unique_lock<std::mutex>& lock) {
+        condition.wait(lock, [this] { return !writing; });
+        if (pendingBuffer.empty() || !file) {
+            return;
+        }
+
+        std::swap(pendingBuffer, writeBuffer);
+        writing = true;
+        FILE* target = file;
+        lock.unlock();
+
+        bool failed = std::fwrite(writeBuffer.data(), 1, writeBuffer.size(), target) != writeBuffer.size();
+        failed = (std::fflush(target) != 0) || failed;  // Make the data visible to readers tailing the file
+
+        lock.lock();
+        if (failed && !writeError) {
+            writeError = std::make_exception_ptr(std::runtime_error("Cannot write statistics file: " + path));
+        }
+        writeBuffer.clear();
+        writing = false;
+        condition.notify_all();
+    }
+
+    void FileStatisticsSink::closeFile() {
+        std::unique_lock<std::mutex> lock(mutex);
+        writePending(lock);
+        if (file) {
+            if (std::fclose(file) != 0 && !writeError) {
+                writeError = std::make_exception_ptr(std::runtime_error("Cannot write statistics file: " + path));
+            }
+            file = nullptr;
+        }
+    }
+
+    // BinaryStatisticsSink implementation
+    BinaryStatisticsSink::BinaryStatisticsSink(const std::string& path, size_t retainLimit, int flushIntervalMs)
+        : FileStatisticsSink(path, retainLimit, flushIntervalMs) {
+    }
+
+    void BinaryStatisticsSink::encodeHeader(std::string& out) const {
+        uint32_t header[4] = {MAGIC, VERSION, RECORD_SIZE, 0};
+        out.append(reinterpret_cast<const char*>(header), sizeof(header));
+    }
+
+    void BinaryStatisticsSink::encodeEntry(const GenerationStats& stats, std::string& out) const {
+        char record[RECORD_SIZE];
+        int32_t generation = stats.generation;
+        double values[7] = {stats.bestFitness, stats.averageFitness, stats.worstFitness, stats.bestValue,
+                            stats.convergence, stats.bestFitnessPercentage, stats.averageFitnessPercentage};
+        std::memcpy(record, &generation, sizeof(generation));
+        std::memcpy(record + sizeof(generation), values, sizeof(values));
+        out.append(record, RECORD_SIZE);
+    }
+
+    bool BinaryStatisticsSink::isBinary() const {
+        return true;
+    }
+
+    // Fixed-size records after the header; a partial last record is dropped
+    long BinaryStatisticsSink::findResumeOffset(FILE* input, int generation) const {
+        uint32_t header[4];
+        if (std::fread(header, sizeof(header), 1, input) != 1) {
+            return 0;
+        }
+
+        long keep = sizeof(header);
+        char record[RECORD_SIZE];
+        while (std::fread(record, RECORD_SIZE, 1, input) == 1) {
+            int32_t recordGeneration;
+            std::memcpy(&recordGeneration, record, sizeof(recordGeneration));
+            if (recordGeneration > generation) {
+                break;
+            }
+            keep += RECORD_SIZE;
+        }
+        return keep;
+    }
+
+    std::vector<GenerationStats> BinaryStatisticsSink::readFile(const std::string& path) {
+        FILE* input = std::fopen(path.c_str(), "rb");
+        if (!input) {
+            throw std::runtime_error("Cannot open statistics file: " + path);
+        }
+
+        uint32_t header[4];
+        if (std::fread(header, sizeof(header), 1, input) != 1 || header[0] != MAGIC ||
+            header[1] != VERSION || header[2] != RECORD_SIZE) {
+            std::fclose(input);
+            throw std::runtime_error("Not a binary statistics file: " + path);
+        }
+
+        // A partially written trailing record (file still being written) is ignored
+        std::vector<GenerationStats> entries;
+        char record[RECORD_SIZE];
+        while (std::fread(record, RECORD_SIZE, 1, input) == 1) {
+            GenerationStats stats;
+            int32_t generation;
+            double values[7];
+            std::memcpy(&generation, record, sizeof(generation));
+            std::memcpy(values, record + sizeof(generation), sizeof(values));
+            stats.generation = generation;
+            stats.bestFitness = values[0];
+            stats.averageFitness = values[1];
+            stats.worstFitness = values[2];
+            stats.bestValue = values[3];
+            stats.convergence = values[4];
+            stats.bestFitnessPercentage = values[5];
+            stats.averageFitnessPercentage = values[6];
+            entries.push_back(stats);
+        }
+
+        std::fclose(input);
+        return entries;
+    }
+
+    // CsvStatisticsSink implementation
+    CsvStatisticsSink::CsvStatisticsSink(const std::string& path, size_t retainLimit, int flushIntervalMs)
+        : FileStatisticsSink(path, retainLimit, flushIntervalMs) {
+    }
+
+    void CsvStatisticsSink::encodeHeader(std::string& out) const {
+        out += "generation,bestFitness,averageFitness,worstFitness,bestValue,"
+               "convergence,bestFitnessPercentage,averageFitnessPercentage\n";
+    }
+
+    void CsvStatisticsSink::encodeEntry(const GenerationStats& stats, std::string& out) const {
+        char line[512];
+        int length = std::snprintf(line, sizeof(line), "%d,%.17g,%.17g,%.17g,%.17g,%.17g,%.17g,%.17g\n",
+                                   stats.generation, stats.bestFitness, stats.averageFitness,
+                                   stats.worstFitness, stats.bestValue, stats.convergence,
+                                   stats.bestFitnessPercentage, stats.averageFitnessPercentage);
+        out.append(line, static_cast<size_t>(length));
+    }
+
+    bool CsvStatisticsSink::isBinary() const {
+        return false;
+    }
+
+    // JsonLinesStatisticsSink implementation
+    JsonLinesStatisticsSink::JsonLinesStatisticsSink(const std::string& path, size_t retainLimit, int flushIntervalMs)
+        : FileStatisticsSink(path, retainLimit, flushIntervalMs) {
+    }
+
+    void JsonLinesStatisticsSink::encodeHeader(std::string& /*out*/) const {
+        // JSON-lines files have no header
+    }
+
+    void JsonLinesStatisticsSink::encodeEntry(const GenerationStats& stats, std::string& out) const {
+        const char* names[7] = {"bestFitness", "averageFitness", "worstFitness", "bestValue",
+                                "convergence", "bestFitnessPercentage", "averageFitnessPercentage"};
+        double values[7] = {stats.bestFitness, stats.averageFitness, stats.worstFitness, stats.bestValue,
+                            stats.convergence, stats.bestFitnessPercentage, stats.averageFitnessPercentage};
+
+        char field[96];
+        std::snprintf(field, sizeof(field), "{\"generation\":%d", stats.generation);
+        out += field;
+        for (int i = 0; i < 7; ++i) {
+            // JSON has no representation for NaN or infinity
+            if (std::isfinite(values[i])) {
+                std::snprintf(field, sizeof(field), ",\"%s\":%.17g", names[i], values[i]);
+            } else {
+                std::snprintf(field, sizeof(field), ",\"%s\":null", names[i]);
+            }
+            out += field;
+        }
+        out += "}\n";
+    }
+
+    bool JsonLinesStatisticsSink::isBinary() const {
+        return false;
+    }
+}
@@ -0,0 +1,268 @@
+#ifndef STATISTICS_SINK_H
+#define STATISTICS_SINK_H
+
+#include "GeneticTypes.h"
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+namespace GA {
+    /**
+     * @class StatisticsSink
+     * @brief Destination for per-generation statistics
+     *
+     * The sink decides how much history stays in memory. It always keeps the
+     * first recorded entry plus the most recent retainLimit entries
+     * (retainLimit = 0 keeps everything), which is what the console summary needs.
+     */
+    class StatisticsSink {
+    private:
+        size_t retainLimit;                        // Number of recent entries kept (0 = unlimited)
+        GenerationStats firstEntry;                // First entry of the run
+        bool hasFirstEntry;                        // Whether firstEntry is set
+        std::vector<GenerationStats> recent;       // Recent entries (ring storage when bounded)
+        size_t recentHead;                         // Index of the oldest entry in the ring
+        size_t recordedCount;                      // Total entries recorded in this run
+        mutable std::vector<GenerationStats> retainedView;  // Linearized copy for getRetained()
+        mutable bool retainedViewDirty;            // Whether retainedView must be rebuilt
+
+        void retain(const GenerationStats& stats);
+
+    protected:
+        /**
+         * @brief Persists one entry (no-op for purely in-memory sinks)
+         * @param stats Statistics to persist
+         */
+        virtual void write(const GenerationStats& stats);
+
+    public:
+        explicit StatisticsSink(size_t retainLimit);
+        virtual ~StatisticsSink() = default;
+
+        /**
+         * @brief Prepares the sink for a run
+         * @param resuming True when continuing a checkpointed run (files are appended)
+         */
+        virtual void begin(bool resuming);
+
+        /**
+         * @brief Records the statistics of one generation
+         * @param stats Statistics to record
+         */
+        void record(const GenerationStats& stats);
+
+        /**
+         * @brief Restores retained history without persisting it again
+         * @param history Entries recorded before a checkpoint
+         */
+        virtual void restore(const std::vector<GenerationStats>& history);
+
+        /**
+         * @brief Drops the retained history
+         */
+        void clear();
+
+        /**
+         * @brief Pushes buffered entries to their destination
+         */
+        virtual void flush();
+
+        /**
+         * @brief Gets the retained history (first entry followed by recent entries)
+         * @return Vector of retained generation statistics
+         */
+        const std::vector<GenerationStats>& getRetained() const;
+
+        /**
+         * @brief Gets the most recently recorded entry
+         * @return The last generation statistics
+         */
+        const GenerationStats& last() const;
+
+        /**
+         * @brief Checks whether anything has been recorded
+         * @return True if no entry is retained
+         */
+        bool empty() const;
+
+        /**
+         * @brief Gets the number of entries recorded in this run
+         * @return Total recorded entries (including ones no longer retained)
+         */
+        size_t getRecordedCount() const;
+    };
+
+    /**
+     * @class InMemoryStatisticsSink
+     * @brief Keeps the complete history in memory (default behaviour)
+     */
+    class InMemoryStatisticsSink : public StatisticsSink {
+    public:
+        InMemoryStatisticsSink();
+    };
+
+    /**
+     * @class RingBufferStatisticsSink
+     * @brief Keeps the first entry plus a bounded ring of recent entries
+     */
+    class RingBufferStatisticsSink : public StatisticsSink {
+    public:
+        explicit RingBufferStatisticsSink(size_t capacity = 10);
+    };
+
+    /**
+     * @class FileStatisticsSink
+     * @brief Base class for append-only file sinks with background flushing
+     *
+     * Entries are encoded into an in-memory buffer; a background thread swaps
+     * the buffer out and writes it every flushIntervalMs milliseconds, so the
+     * file can be tailed while the run is in progress.
+     */
+    class FileStatisticsSink : public StatisticsSink {
+    private:
+        std::string path;                          // Output file path
+        int flushIntervalMs;                       // Background flush period
+        FILE* file;                                // Open output file
+        std::string pendingBuffer;                 // Encoded entries not yet written
+        std::string writeBuffer;                   // Buffer being written by the flusher
+        bool writing;                              // True while writeBuffer is being written
+        bool stopping;                             // Set when the flusher thread must exit
+        std::exception_ptr writeError;             // First write failure, rethrown by flush()
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::thread flusher;
+
+        void flusherLoop();
+        void openFile(bool append);
+        void writePending(std::unique_lock<std::mutex>& lock);
+        void closeFile();
+
+    protected:
+        void write(const GenerationStats& stats) override;
+
+        /**
+         * @brief Encodes the file header (written once when the file is empty)
+         * @param out Buffer to append to
+         */
+        virtual void encodeHeader(std::string& out) const = 0;
+
+        /**
+         * @brief Encodes one entry
+         * @param stats Statistics to encode
+         * @param out Buffer to append to
+         */
+        virtual void encodeEntry(const GenerationStats& stats, std::string& out) const = 0;
+
+        /**
+         * @brief Tells whether the output is binary (affects the file open mode)
+         * @return True for binary formats
+         */
+        virtual bool isBinary() const = 0;
+
+        /**
+         * @brief Finds the end of the last complete entry at or before a generation
+         *
+         * The default reads text lines and takes the first integer on each line
+         * as its generation; lines without one (headers) are kept.
+         * @param input File opened for reading at its start
+         * @param generation Last generation to keep
+         * @return Byte offset just past the entries to keep
+         */
+        virtual long findResumeOffset(FILE* input, int generation) const;
+
+    public:
+        FileStatisticsSink(const std::string& path, size_t retainLimit, int flushIntervalMs);
+        ~FileStatisticsSink() override;
+
+        FileStatisticsSink(const FileStatisticsSink&) = delete;
+        FileStatisticsSink& operator=(const FileStatisticsSink&) = delete;
+
+        void begin(bool resuming) override;
+
+        /**
+         * @brief Restores retained history and drops entries written after it
+         *
+         * Generations recorded after the checkpoint but before the run stopped are
+         * cut from the file, so the resumed run does not write them twice.
+         * @param history Entries recorded before a checkpoint
+         */
+        void restore(const std::vector<GenerationStats>& history) override;
+
+        /**
+         * @brief Writes buffered entries
+         * @throws std::runtime_error if this or an earlier background write failed
+         */
+        void flush() override;
+
+        /**
+         * @brief Gets the output file path
+         * @return The output path
+         */
+        const std::string& getPath() const;
+    };
+
+    /**
+     * @class BinaryStatisticsSink
+     * @brief Append-only binary file: 16-byte header, then fixed 60-byte records
+     *
+     * Record layout: int32 generation followed by bestFitness, averageFitness,
+     * worstFitness, bestValue, convergence, bestFitnessPercentage and
+     * averageFitnessPercentage as doubles (host byte order).
+     */
+    class BinaryStatisticsSink : public FileStatisticsSink {
+    protected:
+        void encodeHeader(std::string& out) const override;
+        void encodeEntry(const GenerationStats& stats, std::string& out) const override;
+        bool isBinary() const override;
+        long findResumeOffset(FILE* input, int generation) const override;
+
+    public:
+        static constexpr uint32_t MAGIC = 0x53534147;  // "GASS" in little-endian order
+        static constexpr uint32_t VERSION = 1;
+        static constexpr uint32_t RECORD_SIZE = 4 + 7 * 8;
+
+        explicit BinaryStatisticsSink(const std::string& path, size_t retainLimit = 10, int flushIntervalMs = 200);
+
+        /**
+         * @brief Reads every record of a binary statistics file
+         * @param path File written by BinaryStatisticsSink
+         * @return Vector of generation statistics
+         */
+        static std::vector<GenerationStats> readFile(const std::string& path);
+    };
+
+    /**
+     * @class CsvStatisticsSink
+     * @brief Append-only CSV file with a header row
+     */
+    class CsvStatisticsSink : public FileStatisticsSink {
+    protected:
+        void encodeHeader(std::string& out) const override;
+        void encodeEntry(const GenerationStats& stats, std::string& out) const override;
+        bool isBinary() const override;
+
+    public:
+        explicit CsvStatisticsSink(const std::string& path, size_t retainLimit = 10, int flushIntervalMs = 200);
+    };
+
+    /**
+     * @class JsonLinesStatisticsSink
+     * @brief Append-only JSON-lines file (one object per generation)
+     */
+    class JsonLinesStatisticsSink : public FileStatisticsSink {
+    protected:
+        void encodeHeader(std::string& out) const override;
+        void encodeEntry(const GenerationStats& stats, std::string& out) const override;
+        bool isBinary() const override;
+
+    public:
+        explicit JsonLinesStatisticsSink(const std::string& path, size_t retainLimit = 10, int flushIntervalMs = 200);
+    };
+}
+
+#endif // STATISTICS_SINK_H
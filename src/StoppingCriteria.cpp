@@ -0,0 +1,265 @@
+#include "StoppingCriteria.h"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+namespace GA {
+
+    namespace {
+        // Next saved value, or an error if the state belongs to a different criterion
+        double readState(const std::vector<double>& state, size_t& position) {
+            if (position >= state.size()) {
+                throw std::runtime_error("Saved stopping criterion state does not match the criterion");
+            }
+            return state[position++];
+        }
+    }
+
+    void StoppingCriterion::begin(const GAConfig&, const FitnessFunction&) {
+    }
+
+    void StoppingCriterion::saveState(std::vector<double>&) const {
+    }
+
+    void StoppingCriterion::restoreState(const std::vector<double>&, size_t&) {
+    }
+
+    // TargetFitnessCriterion implementation
+    TargetFitnessCriterion::TargetFitnessCriterion(double tolerance)
+        : explicitTarget(false), target(std::nan("")), tolerance(tolerance), maximize(true) {
+    }
+
+    TargetFitnessCriterion::TargetFitnessCriterion(double target, double tolerance)
+        : explicitTarget(true), target(target), tolerance(tolerance), maximize(true) {
+    }
+
+    void TargetFitnessCriterion::begin(const GAConfig& config, const FitnessFunction& function) {
+        maximize = config.isMaximization;
+        if (explicitTarget) {
+            return;
+        }
+
+        // Best value over the domain in the direction of this run
+        std::pair<double, double> range = function.getTheoreticalRange(config.minValue, config.maxValue);
+        double rangeBest = (function.isMaximizationProblem() == maximize) ? range.first : range.second;
+
+        // The analytic optimum is only usable if it lies in the domain and is not beaten by the range
+        double optimalX = function.getOptimalX();
+        double optimalValue = function.getOptimalValue();
+        bool optimalUsable = !std::isnan(optimalValue) && !std::isnan(optimalX) &&
+                             optimalX >= config.minValue && optimalX <= config.maxValue &&
+                             (maximize ? optimalValue >= rangeBest : optimalValue <= rangeBest);
+
+        target = optimalUsable ? optimalValue : rangeBest;
+    }
+
+    bool TargetFitnessCriterion::shouldStop(const StoppingContext& context) {
+        if (std::isnan(target)) {
+            return false;
+        }
+        double slack = tolerance * std::max(1.0, std::abs(target));
+        return context.isMaximization ? context.stats.bestFitness >= target - slack
+                                      : context.stats.bestFitness <= target + slack;
+    }
+
+    std::string TargetFitnessCriterion::describe() const {
+        std::ostringstream out;
+        out << "Target fitness " << target << " reached";
+        return out.str();
+    }
+
+    // The derived target depends on the domain, which adaptive refinement narrows during the run
+    void TargetFitnessCriterion::saveState(std::vector<double>& state) const {
+        state.push_back(target);
+        state.push_back(maximize ? 1.0 : 0.0);
+    }
+
+    void TargetFitnessCriterion::restoreState(const std::vector<double>& state, size_t& position) {
+        target = readState(state, position);
+        maximize = readState(state, position) != 0.0;
+    }
+
+    double TargetFitnessCriterion::getTarget() const {
+        return target;
+    }
+
+    // StagnationCriterion implementation
+    StagnationCriterion::StagnationCriterion(int generations, double minImprovement)
+        : patience(generations), minImprovement(minImprovement), hasBest(false), bestFitness(0.0), lastImprovement(0) {
+        if (generations <= 0) {
+            throw std::invalid_argument("Stagnation criterion needs a positive number of generations");
+        }
+    }
+
+    void StagnationCriterion::begin(const GAConfig&, const FitnessFunction&) {
+        hasBest = false;
+        lastImprovement = 0;
+    }
+
+    bool StagnationCriterion::shouldStop(const StoppingContext& context) {
+        double fitness = context.stats.bestFitness;
+        bool improved = !hasBest ||
+                        (context.isMaximization ? fitness > bestFitness + minImprovement
+                                                : fitness < bestFitness - minImprovement);
+        if (improved) {
+            hasBest = true;
+            bestFitness = fitness;
+            lastImprovement = context.generation;
+            return false;
+        }
+        return context.generation - lastImprovement >= patience;
+    }
+
+    std::string StagnationCriterion::describe() const {
+        return "No improvement for " + std::to_string(patience) + " generations";
+    }
+
+    void StagnationCriterion::saveState(std::vector<double>& state) const {
+        state.push_back(hasBest ? 1.0 : 0.0);
+        state.push_back(bestFitness);
+        state.push_back(lastImprovement);
+    }
+
+    void StagnationCriterion::restoreState(const std::vector<double>& state, size_t& position) {
+        hasBest = readState(state, position) != 0.0;
+        bestFitness = readState(state, position);
+        lastImprovement = static_cast<int>(readState(state, position));
+    }
+
+    // WallClockCriterion implementation
+    WallClockCriterion::WallClockCriterion(double seconds) : seconds(seconds) {
+    }
+
+    bool WallClockCriterion::shouldStop(const StoppingContext& context) {
+        return context.elapsedSeconds >= seconds;
+    }
+
+    std::string WallClockCriterion::describe() const {
+        std::ostringstream out;
+        out << "Wall-clock budget of " << seconds << " s used";
+        return out.str();
+    }
+
+    // EvaluationBudgetCriterion implementation
+    EvaluationBudgetCriterion::EvaluationBudgetCriterion(uint64_t maxEvaluations) : maxEvaluations(maxEvaluations) {
+    }
+
+    bool EvaluationBudgetCriterion::shouldStop(const StoppingContext& context) {
+        return context.evaluations >= maxEvaluations;
+    }
+
+    std::string EvaluationBudgetCriterion::describe() const {
+        return "Evaluation budget of " + std::to_string(maxEvaluations) + " used";
+    }
+
+    // DiversityCriterion implementation
+    DiversityCriterion::DiversityCriterion(double threshold) : threshold(threshold) {
+    }
+
+    bool DiversityCriterion::shouldStop(const StoppingContext& context) {
+        return context.stats.convergence < threshold;
+    }
+
+    std::string DiversityCriterion::describe() const {
+        std::ostringstream out;
+        out << "Population diversity below " << threshold;
+        return out.str();
+    }
+
+    // AnyOfCriterion implementation
+    AnyOfCriterion::AnyOfCriterion() : fired(nullptr) {
+    }
+
+    AnyOfCriterion& AnyOfCriterion::add(std::unique_ptr<StoppingCriterion> criterion) {
+        if (!criterion) {
+            throw std::invalid_argument("Stopping criterion cannot be null");
+        }
+        children.push_back(std::move(criterion));
+        return *this;
+    }
+
+    void AnyOfCriterion::begin(const GAConfig& config, const FitnessFunction& function) {
+        fired = nullptr;
+        for (std::unique_ptr<StoppingCriterion>& child : children) {
+            child->begin(config, function);
+        }
+    }
+
+    bool AnyOfCriterion::shouldStop(const StoppingContext& context) {
+        for (std::unique_ptr<StoppingCriterion>& child : children) {
+            if (child->shouldStop(context) && !fired) {
+                fired = child.get();
+            }
+        }
+        return fired != nullptr;
+    }
+
+    std::string AnyOfCriterion::describe() const {
+        if (fired) {
+            return fired->describe();
+        }
+        std::string text;
+        for (size_t i = 0; i < children.size(); ++i) {
+            text += (i == 0 ? "" : " or ") + children[i]->describe();
+        }
+        return text;
+    }
+
+    void AnyOfCriterion::saveState(std::vector<double>& state) const {
+        for (const std::unique_ptr<StoppingCriterion>& child : children) {
+            child->saveState(state);
+        }
+    }
+
+    void AnyOfCriterion::restoreState(const std::vector<double>& state, size_t& position) {
+        for (std::unique_ptr<StoppingCriterion>& child : children) {
+            child->restoreState(state, position);
+        }
+    }
+
+    // AllOfCriterion implementation
+    AllOfCriterion& AllOfCriterion::add(std::unique_ptr<StoppingCriterion> criterion) {
+        if (!criterion) {
+            throw std::invalid_argument("Stopping criterion cannot be null");
+        }
+        children.push_back(std::move(criterion));
+        return *this;
+    }
+
+    void AllOfCriterion::begin(const GAConfig& config, const FitnessFunction& function) {
+        for (std::unique_ptr<StoppingCriterion>& child : children) {
+            child->begin(config, function);
+        }
+    }
+
+    bool AllOfCriterion::shouldStop(const StoppingContext& context) {
+        bool all = !children.empty();
+        for (std::unique_ptr<StoppingCriterion>& child : children) {
+            if (!child->shouldStop(context)) {
+                all = false;
+            }
+        }
+        return all;
+    }
+
+    std::string AllOfCriterion::describe() const {
+        std::string text;
+        for (size_t i = 0; i < children.size(); ++i) {
+            text += (i == 0 ? "" : " and ") + children[i]->describe();
+        }
+        return text;
+    }
+
+    void AllOfCriterion::saveState(std::vector<double>& state) const {
+        for (const std::unique_ptr<StoppingCriterion>& child : children) {
+            child->saveState(state);
+        }
+    }
+
+    void AllOfCriterion::restoreState(const std::vector<double>& state, size_t& position) {
+        for (std::unique_ptr<StoppingCriterion>& child : children) {
+            child->restoreState(state, position);
+        }
+    }
+}
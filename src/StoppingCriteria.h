@@ -0,0 +1,264 @@
+#ifndef STOPPING_CRITERIA_H
+#define STOPPING_CRITERIA_H
+
+#include "GeneticTypes.h"
+#include "FitnessFunction.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace GA {
+    /**
+     * @struct StoppingContext
+     * @brief What a stopping criterion observes after each generation
+     *
+     * Every field is already known to the engine, so criteria decide in O(1)
+     * without touching the population.
+     */
+    struct StoppingContext {
+        const GenerationStats& stats;              // Statistics of the generation just completed
+        int generation;                            // Generation number
+        uint64_t evaluations;                      // Fitness evaluations so far (cache hits excluded)
+        double elapsedSeconds;                     // Wall time since the run started
+        bool isMaximization;                       // Optimization direction
+    };
+
+    /**
+     * @class StoppingCriterion
+     * @brief Base class for pluggable termination policies
+     *
+     * shouldStop() is called once per generation, in order, so criteria may
+     * keep incremental state between calls. begin() resets that state;
+     * saveState() and restoreState() carry it through checkpoints so a resumed
+     * run stops where the uninterrupted run would have.
+     */
+    class StoppingCriterion {
+    public:
+        virtual ~StoppingCriterion() = default;
+
+        /**
+         * @brief Prepares the criterion for a new run
+         * @param config Algorithm configuration of the run
+         * @param function Fitness function being optimized
+         */
+        virtual void begin(const GAConfig& config, const FitnessFunction& function);
+
+        /**
+         * @brief Decides whether the run should stop after this generation
+         * @param context Observations of the generation just completed
+         * @return True to stop
+         */
+        virtual bool shouldStop(const StoppingContext& context) = 0;
+
+        /**
+         * @brief Describes the criterion (or, after it fired, why it fired)
+         * @return Human-readable description
+         */
+        virtual std::string describe() const = 0;
+
+        /**
+         * @brief Appends the incremental state to a checkpoint (default: stateless)
+         * @param state Values appended in a fixed order
+         */
+        virtual void saveState(std::vector<double>& state) const;
+
+        /**
+         * @brief Restores the state written by saveState (called after begin())
+         * @param state Saved values
+         * @param position Next value to read; advanced past this criterion's values
+         *
+         * Throws std::runtime_error if the state is shorter than expected.
+         */
+        virtual void restoreState(const std::vector<double>& state, size_t& position);
+    };
+
+    /**
+     * @class TargetFitnessCriterion
+     * @brief Stops once the best fitness reaches a target value
+     *
+     * Without an explicit target, the function's getOptimalValue() is used when
+     * it is known and lies in the domain; otherwise the best value of
+     * getTheoreticalRange() is used (exact for the built-in functions).
+     */
+    class TargetFitnessCriterion : public StoppingCriterion {
+    private:
+        bool explicitTarget;                       // Target supplied by the caller
+        double target;                             // Fitness to reach
+        double tolerance;                          // Relative tolerance (scaled by max(1, |target|))
+        bool maximize;                             // Direction of the run
+
+    public:
+        /**
+         * @brief Creates a criterion that derives its target from the fitness function
+         * @param tolerance Relative tolerance
+         */
+        explicit TargetFitnessCriterion(double tolerance = 1e-6);
+
+        /**
+         * @brief Creates a criterion with an explicit target
+         * @param target Fitness to reach
+         * @param tolerance Relative tolerance
+         */
+        TargetFitnessCriterion(double target, double tolerance);
+
+        void begin(const GAConfig& config, const FitnessFunction& function) override;
+        bool shouldStop(const StoppingContext& context) override;
+        std::string describe() const override;
+        void saveState(std::vector<double>& state) const override;
+        void restoreState(const std::vector<double>& state, size_t& position) override;
+
+        double getTarget() const;
+    };
+
+    /**
+     * @class StagnationCriterion
+     * @brief Stops when the best fitness has not improved for N generations
+     */
+    class StagnationCriterion : public StoppingCriterion {
+    private:
+        int patience;                              // Generations allowed without improvement
+        double minImprovement;                     // Improvement smaller than this does not count
+        bool hasBest;                              // Whether a best value has been seen
+        double bestFitness;                        // Best fitness seen so far
+        int lastImprovement;                       // Generation of the last improvement
+
+    public:
+        /**
+         * @brief Creates the criterion
+         * @param generations Generations without improvement before stopping
+         * @param minImprovement Smallest change counted as an improvement
+         */
+        explicit StagnationCriterion(int generations, double minImprovement = 0.0);
+
+        void begin(const GAConfig& config, const FitnessFunction& function) override;
+        bool shouldStop(const StoppingContext& context) override;
+        std::string describe() const override;
+        void saveState(std::vector<double>& state) const override;
+        void restoreState(const std::vector<double>& state, size_t& position) override;
+    };
+
+    /**
+     * @class WallClockCriterion
+     * @brief Stops once the run has used its wall-clock budget
+     */
+    class WallClockCriterion : public StoppingCriterion {
+    private:
+        double seconds;                            // Budget in seconds
+
+    public:
+        explicit WallClockCriterion(double seconds);
+
+        bool shouldStop(const StoppingContext& context) override;
+        std::string describe() const override;
+    };
+
+    /**
+     * @class EvaluationBudgetCriterion
+     * @brief Stops once the number of fitness evaluations reaches a budget
+     */
+    class EvaluationBudgetCriterion : public StoppingCriterion {
+    private:
+        uint64_t maxEvaluations;                   // Evaluation budget
+
+    public:
+        explicit EvaluationBudgetCriterion(uint64_t maxEvaluations);
+
+        bool shouldStop(const StoppingContext& context) override;
+        std::string describe() const override;
+    };
+
+    /**
+     * @class DiversityCriterion
+     * @brief Stops when population diversity falls below a threshold
+     *
+     * Uses the diversity already stored in GenerationStats::convergence.
+     */
+    class DiversityCriterion : public StoppingCriterion {
+    private:
+        double threshold;                          // Diversity below which the run stops
+
+    public:
+        explicit DiversityCriterion(double threshold = 0.01);
+
+        bool shouldStop(const StoppingContext& context) override;
+        std::string describe() const override;
+    };
+
+    /**
+     * @class AnyOfCriterion
+     * @brief Stops when at least one child criterion says so (OR)
+     *
+     * Every child is consulted each generation so stateful children stay current.
+     */
+    class AnyOfCriterion : public StoppingCriterion {
+    private:
+        std::vector<std::unique_ptr<StoppingCriterion>> children;
+        const StoppingCriterion* fired;            // Child that stopped the run (if any)
+
+    public:
+        AnyOfCriterion();
+
+        /**
+         * @brief Adds a child criterion
+         * @param criterion Criterion to combine
+         * @return This combinator (for chaining)
+         */
+        AnyOfCriterion& add(std::unique_ptr<StoppingCriterion> criterion);
+
+        void begin(const GAConfig& config, const FitnessFunction& function) override;
+        bool shouldStop(const StoppingContext& context) override;
+        std::string describe() const override;
+        void saveState(std::vector<double>& state) const override;
+        void restoreState(const std::vector<double>& state, size_t& position) override;
+    };
+
+    /**
+     * @class AllOfCriterion
+     * @brief Stops when every child criterion says so in the same generation (AND)
+     */
+    class AllOfCriterion : public StoppingCriterion {
+    private:
+        std::vector<std::unique_ptr<StoppingCriterion>> children;
+
+    public:
+        /**
+         * @brief Adds a child criterion
+         * @param criterion Criterion to combine
+         * @return This combinator (for chaining)
+         */
+        AllOfCriterion& add(std::unique_ptr<StoppingCriterion> criterion);
+
+        void begin(const GAConfig& config, const FitnessFunction& function) override;
+        bool shouldStop(const StoppingContext& context) override;
+        std::string describe() const override;
+        void saveState(std::vector<double>& state) const override;
+        void restoreState(const std::vector<double>& state, size_t& position) override;
+    };
+
+    /**
+     * @brief Combines criteria with OR
+     * @param criteria Criteria to combine
+     * @return Combined criterion
+     */
+    template <typename... Criteria>
+    std::unique_ptr<AnyOfCriterion> anyOf(std::unique_ptr<Criteria>... criteria) {
+        std::unique_ptr<AnyOfCriterion> combined = std::make_unique<AnyOfCriterion>();
+        (combined->add(std::move(criteria)), ...);
+        return combined;
+    }
+
+    /**
+     * @brief Combines criteria with AND
+     * @param criteria Criteria to combine
+     * @return Combined criterion
+     */
+    template <typename... Criteria>
+    std::unique_ptr<AllOfCriterion> allOf(std::unique_ptr<Criteria>... criteria) {
+        std::unique_ptr<AllOfCriterion> combined = std::make_unique<AllOfCriterion>();
+        (combined->add(std::move(criteria)), ...);
+        return combined;
+    }
+}
+
+#endif // STOPPING_CRITERIA_H
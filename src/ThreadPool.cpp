@@ -0,0 +1,118 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace GA {
+
+    // Constructor
+    ThreadPool::ThreadPool(int threadCount)
+        : job(nullptr), jobCount(0), chunkSize(1), nextIndex(0), jobSequence(0), activeWorkers(0), stopping(false) {
+        if (threadCount <= 0) {
+            threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        }
+
+        workers.reserve(threadCount - 1);
+        for (int worker = 1; worker < threadCount; ++worker) {
+            workers.emplace_back(&ThreadPool::workerLoop, this, worker);
+        }
+    }
+
+    // Destructor
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        jobAvailable.notify_all();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    int ThreadPool::getThreadCount() const {
+        return static_cast<int>(workers.size()) + 1;
+    }
+
+    // Claim and execute chunks until the index space is exhausted
+    void ThreadPool::runChunks(int worker) {
+        while (true) {
+            size_t begin = nextIndex.fetch_add(chunkSize);
+            if (begin >= jobCount) {
+                return;
+            }
+            size_t end = std::min(jobCount, begin + chunkSize);
+
+            try {
+                (*job)(begin, end, worker);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!jobError) {
+                    jobError = std::current_exception();
+                }
+                nextIndex.store(jobCount);  // Abandon the remaining chunks
+            }
+        }
+    }
+
+    // Background worker: wait for a job, help with it, report completion
+    void ThreadPool::workerLoop(int worker) {
+        uint64_t seenSequence = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                jobAvailable.wait(lock, [&] { return stopping || jobSequence != seenSequence; });
+                if (stopping) {
+                    return;
+                }
+                seenSequence = jobSequence;
+            }
+
+            runChunks(worker);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--activeWorkers == 0) {
+                    jobFinished.notify_one();
+                }
+            }
+        }
+    }
+
+    // Run a range in parallel on the pool and the calling thread
+    void ThreadPool::parallelFor(size_t count, const RangeFunction& body, size_t minChunk) {
+        if (count == 0) {
+            return;
+        }
+
+        // Without background threads (or for tiny ranges) run inline
+        size_t threads = workers.size() + 1;
+        if (workers.empty() || count <= minChunk) {
+            body(0, count, 0);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = &body;
+            jobCount = count;
+            chunkSize = std::max(std::max<size_t>(minChunk, 1), count / (threads * 4));
+            nextIndex.store(0);
+            jobError = nullptr;
+            activeWorkers = static_cast<int>(workers.size());
+            ++jobSequence;
+        }
+        jobAvailable.notify_all();
+
+        runChunks(0);
+
+        std::exception_ptr error;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            jobFinished.wait(lock, [&] { return activeWorkers == 0; });
+            job = nullptr;
+            error = jobError;
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
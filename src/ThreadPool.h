@@ -0,0 +1,73 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <cstddef>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+
+namespace GA {
+    /**
+     * @class ThreadPool
+     * @brief Fixed set of worker threads that execute index ranges in parallel
+     *
+     * The calling thread takes part in every parallelFor as worker 0, so a pool
+     * of N threads starts N - 1 background threads. Ranges are split into
+     * chunks that workers claim dynamically.
+     */
+    class ThreadPool {
+    public:
+        // Range body: [begin, end) of the index space and the executing worker index
+        using RangeFunction = std::function<void(size_t begin, size_t end, int worker)>;
+
+    private:
+        std::vector<std::thread> workers;          // Background threads (worker indices 1..N-1)
+        std::mutex mutex;                          // Guards job publication and completion
+        std::condition_variable jobAvailable;      // Signals a new job or shutdown
+        std::condition_variable jobFinished;       // Signals that all workers left the job
+        const RangeFunction* job;                  // Body of the current job
+        size_t jobCount;                           // Size of the current index space
+        size_t chunkSize;                          // Indices claimed per chunk
+        std::atomic<size_t> nextIndex;             // First unclaimed index
+        uint64_t jobSequence;                      // Incremented for every job
+        int activeWorkers;                         // Background workers still inside the job
+        std::exception_ptr jobError;               // First exception thrown by the body
+        bool stopping;                             // Set on destruction
+
+        void workerLoop(int worker);
+        void runChunks(int worker);
+
+    public:
+        /**
+         * @brief Creates the pool
+         * @param threadCount Total number of threads including the caller (0 = hardware concurrency)
+         */
+        explicit ThreadPool(int threadCount);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief Gets the number of threads that take part in parallelFor
+         * @return Thread count including the caller
+         */
+        int getThreadCount() const;
+
+        /**
+         * @brief Runs body over [0, count) split into chunks and waits for completion
+         * @param count Size of the index space
+         * @param body Function called for each chunk
+         * @param minChunk Smallest chunk handed to a worker
+         *
+         * The first exception thrown by body is rethrown in the caller.
+         */
+        void parallelFor(size_t count, const RangeFunction& body, size_t minChunk = 1);
+    };
+}
+
+#endif // THREAD_POOL_H
@@ -163,7 +163,9 @@ void demonstrateDetailedEvolution(GeneticAlgorithm& ga, ConsoleInterface& ui) {
     std::cout << std::endl;
     
     // Show final results
-    ui.displayFinalResults(ga.getStatistics(), ga.getBestIndividual(), ga.getConfig(), ga.getFitnessFunction());
+    ui.displayFinalResults(ga.getStatistics(), ga.getBestSoFar(), ga.getConfig(), ga.getFitnessFunction());
+    ui.displayRunSummary(ga.getRunSummary());
+    ui.displayProfile(ga.getProfile());
     
     // Wait for user to review results
     ui.waitForKeyPress("Press any key to return to the main menu...");
@@ -203,7 +205,9 @@ void runQuickDemo(GeneticAlgorithm& ga, ConsoleInterface& ui) {
     ui.resetColor();
     std::cout << std::endl;
     
-    ui.displayFinalResults(ga.getStatistics(), ga.getBestIndividual(), ga.getConfig(), ga.getFitnessFunction());
+    ui.displayFinalResults(ga.getStatistics(), ga.getBestSoFar(), ga.getConfig(), ga.getFitnessFunction());
+    ui.displayRunSummary(ga.getRunSummary());
+    ui.displayProfile(ga.getProfile());
     ui.waitForKeyPress();
 }
 